@@ -110,6 +110,8 @@ struct Gia_Man_t_
     Vec_Int_t *    vCos;          // the vector of COs (POs + LIs)
     Vec_Int_t      vHash;         // hash links
     Vec_Int_t      vHTable;       // hash table
+    Vec_Int_t      vHTableOld;    // hash table being migrated after resizing
+    int            iHTableMove;   // the next entry of the old table to migrate
     int            fAddStrash;    // performs additional structural hashing
     int            fSweeper;      // sweeper is running
     int            fGiaSimple;    // simple mode (no const-propagation and strashing)
@@ -1189,9 +1191,14 @@ static inline int         Gia_ObjCellId( Gia_Man_t * p, int iLit )          { re
 
 /*=== giaAiger.c ===========================================================*/
 extern int                 Gia_FileSize( char * pFileName );
+extern char *              Gia_FileLoadContents( char * pFileName, int * pnFileSize, int * pfMapped );
+extern void                Gia_FileUnloadContents( char * pContents, int nFileSize, int fMapped );
 extern Gia_Man_t *         Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadFromMemoryPar( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads );
 extern Gia_Man_t *         Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck );
+extern Gia_Man_t *         Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads );
 extern void                Gia_AigerWrite( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact );
+extern void                Gia_AigerWritePar( Gia_Man_t * p, char * pFileName, int fWriteSymbols, int fCompact, int nThreads );
 extern void                Gia_DumpAiger( Gia_Man_t * p, char * pFilePrefix, int iFileNum, int nFileNumDigits );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStr( Gia_Man_t * p );
 extern Vec_Str_t *         Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Vec_Int_t * vAnds, Vec_Int_t * vCos, int nRegs );
@@ -1520,6 +1527,10 @@ extern unsigned *          Gia_SimDataCoExt( Gia_ManSim_t * p, int i );
 extern void                Gia_ManSimInfoInit( Gia_ManSim_t * p );
 extern void                Gia_ManSimInfoTransfer( Gia_ManSim_t * p );
 extern void                Gia_ManSimulateRound( Gia_ManSim_t * p );
+extern void                Gia_ManSimAndWords( unsigned * pRes, unsigned * pInfo0, unsigned * pInfo1, int fCompl0, int fCompl1, int nWords );
+extern int                 Gia_ManSimKernelSelect( int iKernel );
+extern char *              Gia_ManSimKernelName( int iKernel );
+extern void                Gia_ManSimBenchmark( Gia_Man_t * pAig, Gia_ParSim_t * pPars );
 extern void                Gia_ManBuiltInSimStart( Gia_Man_t * p, int nWords, int nObjs );
 extern void                Gia_ManBuiltInSimPerform( Gia_Man_t * p, int iObj );
 extern int                 Gia_ManBuiltInSimCheckOver( Gia_Man_t * p, int iLit0, int iLit1 );
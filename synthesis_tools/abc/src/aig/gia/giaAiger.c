@@ -23,10 +23,30 @@
 #include "misc/tim/tim.h"
 #include "base/main/main.h"
 
+#if !defined(_WIN32)
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 #define XAIG_VERBOSE 0
 
+#define GIA_AIG_PAR_THR_MAX  100   // the max number of threads
+#define GIA_AIG_PAR_AND_MIN 100000 // the min number of AND nodes to use threads
+
 ////////////////////////////////////////////////////////////////////////
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
@@ -164,7 +184,220 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
 
 /**Function*************************************************************
 
-  Synopsis    [Reads the AIG in the binary AIGER format.]
+  Synopsis    [Loads the file contents into memory.]
+
+  Description [On systems other than Windows, the file is mapped into 
+  memory, which avoids copying large files. Otherwise, and if mapping 
+  fails, the file is read into an allocated buffer. Sets *pfMapped 
+  to indicate which of the two is used, which should be passed to 
+  Gia_FileUnloadContents() when the contents are no longer needed.
+  In both cases, the byte following the contents is set to '\n', so 
+  that the parser scanning for the end of line stops at the end of 
+  the file. The file is mapped only if this byte falls into the last 
+  page of the mapping, that is, if the file size is not a multiple of 
+  the page size.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_FileLoadContents( char * pFileName, int * pnFileSize, int * pfMapped )
+{
+    FILE * pFile;
+    char * pContents;
+    int RetValue;
+    *pfMapped = 0;
+#if !defined(_WIN32)
+    {
+        struct stat Stat;
+        int Fd = open( pFileName, O_RDONLY );
+        if ( Fd >= 0 && fstat(Fd, &Stat) == 0 && Stat.st_size > 0 && Stat.st_size < 0x7FFFFFFF && 
+             Stat.st_size % sysconf(_SC_PAGESIZE) != 0 )
+        {
+            pContents = (char *)mmap( NULL, (size_t)Stat.st_size + 1, PROT_READ | PROT_WRITE, MAP_PRIVATE, Fd, 0 );
+            if ( pContents != (char *)MAP_FAILED )
+            {
+                close( Fd );
+                *pnFileSize = (int)Stat.st_size;
+                *pfMapped = 1;
+                pContents[*pnFileSize] = '\n';
+                return pContents;
+            }
+        }
+        if ( Fd >= 0 )
+            close( Fd );
+    }
+#endif
+    *pnFileSize = Gia_FileSize( pFileName );
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+        return NULL;
+    pContents = ABC_ALLOC( char, *pnFileSize + 1 );
+    RetValue = fread( pContents, *pnFileSize, 1, pFile );
+    fclose( pFile );
+    pContents[*pnFileSize] = '\n';
+    return pContents;
+}
+void Gia_FileUnloadContents( char * pContents, int nFileSize, int fMapped )
+{
+#if !defined(_WIN32)
+    if ( fMapped )
+    {
+        munmap( pContents, (size_t)nFileSize + 1 );
+        return;
+    }
+#endif
+    ABC_FREE( pContents );
+}
+
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Gia_AigParThData_t_ Gia_AigParThData_t;
+struct Gia_AigParThData_t_
+{
+    unsigned char *  pStart;         // the beginning of the encoded section
+    unsigned char *  pBeg;           // the beginning of the chunk
+    unsigned char *  pEnd;           // the end of the chunk
+    unsigned *       pValues;        // the decoded values
+    int              nValues;        // the number of values in the section
+    int              iFirst;         // the index of the first value terminated in the chunk
+    int              nTerms;         // the number of values terminated in the chunk
+    unsigned char *  pStop;          // the end of the section (if it is in the chunk)
+    Gia_Man_t *      p;              // the AIG to encode
+    int              iObjBeg;        // the first node to encode
+    int              iObjEnd;        // the node following the last node to encode
+    Vec_Str_t *      vBuffer;        // the encoded nodes
+};
+
+/**Function*************************************************************
+
+  Synopsis    [Counts the values terminated in the chunk.]
+
+  Description [Each value in the AIGER binary encoding takes several bytes, 
+  the last of which is the only one that has the most significant bit 
+  equal to 0.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_AigerReadCountThread( void * pArg )
+{
+    Gia_AigParThData_t * pThData = (Gia_AigParThData_t *)pArg;
+    unsigned char * pCur;
+    int nTerms = 0;
+    for ( pCur = pThData->pBeg; pCur < pThData->pEnd; pCur++ )
+        nTerms += (*pCur < 0x80);
+    pThData->nTerms = nTerms;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes the values terminated in the chunk.]
+
+  Description [The first value may start in the previous chunk. Since
+  one value takes at most five bytes, it is found by scanning back
+  a few bytes from the beginning of the chunk.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Gia_AigerReadDecodeThread( void * pArg )
+{
+    Gia_AigParThData_t * pThData = (Gia_AigParThData_t *)pArg;
+    unsigned char * pCur = pThData->pBeg;
+    int i, iStop = Abc_MinInt( pThData->iFirst + pThData->nTerms, pThData->nValues );
+    while ( pCur > pThData->pStart && pCur[-1] >= 0x80 )
+        pCur--;
+    for ( i = pThData->iFirst; i < iStop; i++ )
+        pThData->pValues[i] = Gia_AigerReadUnsigned( &pCur );
+    if ( i == pThData->nValues && pThData->iFirst < i )
+        pThData->pStop = pCur;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Decodes the given number of values using several threads.]
+
+  Description [The remaining part of the file is divided into chunks of 
+  equal size. In the first pass, the threads count the values terminated 
+  in each chunk, which gives the index of the first value in each chunk. 
+  In the second pass, the threads decode the values of their chunks.
+  Returns the array of values and updates the current reading position, 
+  or returns NULL if the file contains fewer values than expected.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Int_t * Gia_AigerReadUnsignedPar( unsigned char ** ppPos, unsigned char * pLimit, int nValues, int nThreads )
+{
+    pthread_t WorkerThread[GIA_AIG_PAR_THR_MAX];
+    Gia_AigParThData_t ThData[GIA_AIG_PAR_THR_MAX];
+    Vec_Int_t * vValues;
+    int nChunk, k, iFirst, status;
+    nThreads = Abc_MinInt( nThreads, GIA_AIG_PAR_THR_MAX );
+    nChunk   = (int)((pLimit - *ppPos) / nThreads) + 1;
+    vValues  = Vec_IntStart( nValues );
+    memset( ThData, 0, sizeof(Gia_AigParThData_t) * nThreads );
+    for ( k = 0; k < nThreads; k++ )
+    {
+        ThData[k].pStart  = *ppPos;
+        ThData[k].pBeg    = Abc_MinInt( k * nChunk, (int)(pLimit - *ppPos) ) + *ppPos;
+        ThData[k].pEnd    = Abc_MinInt( (k + 1) * nChunk, (int)(pLimit - *ppPos) ) + *ppPos;
+        ThData[k].pValues = (unsigned *)Vec_IntArray( vValues );
+        ThData[k].nValues = nValues;
+    }
+    // count the values in each chunk (the main thread is used as the last worker)
+    for ( k = 0; k < nThreads - 1; k++ )
+    {
+        status = pthread_create( WorkerThread + k, NULL, Gia_AigerReadCountThread, (void *)(ThData + k) );  
+        assert( status == 0 );
+    }
+    Gia_AigerReadCountThread( (void *)(ThData + nThreads - 1) );
+    for ( k = 0; k < nThreads - 1; k++ )
+    {
+        status = pthread_join( WorkerThread[k], NULL );  
+        assert( status == 0 );
+    }
+    for ( iFirst = k = 0; k < nThreads; k++ )
+    {
+        ThData[k].iFirst = iFirst;
+        iFirst += ThData[k].nTerms;
+    }
+    if ( iFirst < nValues )
+    {
+        Vec_IntFree( vValues );
+        return NULL;
+    }
+    // decode the values
+    for ( k = 0; k < nThreads - 1; k++ )
+    {
+        status = pthread_create( WorkerThread + k, NULL, Gia_AigerReadDecodeThread, (void *)(ThData + k) );  
+        assert( status == 0 );
+    }
+    Gia_AigerReadDecodeThread( (void *)(ThData + nThreads - 1) );
+    for ( k = 0; k < nThreads - 1; k++ )
+    {
+        status = pthread_join( WorkerThread[k], NULL );  
+        assert( status == 0 );
+    }
+    for ( k = 0; k < nThreads; k++ )
+        if ( ThData[k].pStop )
+            *ppPos = ThData[k].pStop;
+    return vValues;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Encodes the AND nodes in the given range.]
 
   Description []
   
@@ -173,10 +406,96 @@ Vec_Str_t * Gia_AigerWriteLiterals( Vec_Int_t * vLits )
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+void * Gia_AigerWriteEncodeThread( void * pArg )
+{
+    Gia_AigParThData_t * pThData = (Gia_AigParThData_t *)pArg;
+    Gia_Man_t * p = pThData->p;
+    Vec_Str_t * vBuffer = pThData->vBuffer;
+    unsigned char * pBuffer = (unsigned char *)Vec_StrArray(vBuffer);
+    unsigned uLit0, uLit1, uLit;
+    int i, Pos = 0;
+    for ( i = pThData->iObjBeg; i < pThData->iObjEnd; i++ )
+    {
+        Gia_Obj_t * pObj = Gia_ManObj( p, i );
+        assert( Gia_ObjIsAnd(pObj) );
+        uLit  = Abc_Var2Lit( i, 0 );
+        uLit0 = Gia_ObjFaninLit0( pObj, i );
+        uLit1 = Gia_ObjFaninLit1( pObj, i );
+        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
+        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
+    }
+    assert( Pos <= Vec_StrCap(vBuffer) );
+    vBuffer->nSize = Pos;
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Writes the AND nodes using several threads.]
+
+  Description [The AND nodes of the normalized AIG have consecutive IDs.
+  They are divided into equal ranges, which are encoded concurrently 
+  into separate buffers, and the buffers are written in order.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_AigerWriteAndsPar( Gia_Man_t * p, FILE * pFile, int nThreads )
+{
+    pthread_t WorkerThread[GIA_AIG_PAR_THR_MAX];
+    Gia_AigParThData_t ThData[GIA_AIG_PAR_THR_MAX];
+    int iObjBeg = 1 + Gia_ManCiNum(p);
+    int nChunk, k, status;
+    nThreads = Abc_MinInt( nThreads, GIA_AIG_PAR_THR_MAX );
+    nChunk   = Gia_ManAndNum(p) / nThreads + 1;
+    memset( ThData, 0, sizeof(Gia_AigParThData_t) * nThreads );
+    for ( k = 0; k < nThreads; k++ )
+    {
+        ThData[k].p       = p;
+        ThData[k].iObjBeg = iObjBeg + Abc_MinInt( k * nChunk, Gia_ManAndNum(p) );
+        ThData[k].iObjEnd = iObjBeg + Abc_MinInt( (k + 1) * nChunk, Gia_ManAndNum(p) );
+        // one node takes at most ten bytes
+        ThData[k].vBuffer = Vec_StrAlloc( 10 * (ThData[k].iObjEnd - ThData[k].iObjBeg) + 10 );
+    }
+    for ( k = 0; k < nThreads - 1; k++ )
+    {
+        status = pthread_create( WorkerThread + k, NULL, Gia_AigerWriteEncodeThread, (void *)(ThData + k) );  
+        assert( status == 0 );
+    }
+    Gia_AigerWriteEncodeThread( (void *)(ThData + nThreads - 1) );
+    for ( k = 0; k < nThreads - 1; k++ )
+    {
+        status = pthread_join( WorkerThread[k], NULL );  
+        assert( status == 0 );
+    }
+    for ( k = 0; k < nThreads; k++ )
+    {
+        fwrite( Vec_StrArray(ThData[k].vBuffer), 1, Vec_StrSize(ThData[k].vBuffer), pFile );
+        Vec_StrFree( ThData[k].vBuffer );
+    }
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the AIG in the binary AIGER format.]
+
+  Description [When several threads are given, the AND gates of large
+  AIGs are first decoded in parallel (see Gia_AigerReadUnsignedPar), and 
+  then the AIG is constructed using the decoded literals.]
+  
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Gia_AigerReadFromMemoryPar( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads )
 {
     Gia_Man_t * pNew, * pTemp;
-    Vec_Int_t * vLits = NULL, * vPoTypes = NULL;
+    Vec_Int_t * vLits = NULL, * vPoTypes = NULL, * vDeltas = NULL;
     Vec_Int_t * vNodes, * vDrivers, * vInits = NULL;
     int iObj, iNode0, iNode1, fHieOnly = 0;
     int nTotal, nInputs, nOutputs, nLatches, nAnds, i;
@@ -184,6 +503,15 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     unsigned char * pDrivers, * pSymbols, * pCur;
     unsigned uLit0, uLit1, uLit;
 
+    // make sure the parameter line has all the fields before reading them
+    for ( i = 0, pCur = (unsigned char *)pContents; pCur < (unsigned char *)pContents + nFileSize && *pCur != '\n'; pCur++ )
+        i += (*pCur == ' ');
+    if ( i < 5 || pCur == (unsigned char *)pContents + nFileSize )
+    {
+        fprintf( stdout, "The parameter line is in a wrong format.\n" );
+        return NULL;
+    }
+
     // read the parameters (M I L O A + B C J F)
     pCur = (unsigned char *)pContents;         while ( *pCur != ' ' ) pCur++; pCur++;
     // read the number of objects
@@ -273,23 +601,54 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     if ( pContents[3] == ' ' ) // standard AIGER
     {
         // scroll to the beginning of the binary data
-        for ( i = 0; i < nLatches + nOutputs; )
+        for ( i = 0; i < nLatches + nOutputs && pCur < (unsigned char *)pContents + nFileSize; )
             if ( *pCur++ == '\n' )
                 i++;
+        if ( i < nLatches + nOutputs )
+        {
+            fprintf( stdout, "The file is truncated before the binary data.\n" );
+            Vec_IntFree( vNodes );
+            Gia_ManStop( pNew );
+            return NULL;
+        }
     }
     else // modified AIGER
     {
         vLits = Gia_AigerReadLiterals( &pCur, nLatches + nOutputs );
     }
 
+#ifdef ABC_USE_PTHREADS
+    // decode the AND gates
+    if ( nThreads > 1 && nAnds >= GIA_AIG_PAR_AND_MIN )
+    {
+        vDeltas = Gia_AigerReadUnsignedPar( &pCur, (unsigned char *)pContents + nFileSize, 2 * nAnds, nThreads );
+        if ( vDeltas == NULL )
+        {
+            fprintf( stdout, "The number of AND gates does not match.\n" );
+            Vec_IntFreeP( &vLits );
+            Vec_IntFree( vNodes );
+            Gia_ManStop( pNew );
+            return NULL;
+        }
+    }
+#endif
+
     // create the AND gates
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashAlloc( pNew );
     for ( i = 0; i < nAnds; i++ )
     {
         uLit = ((i + 1 + nInputs + nLatches) << 1);
-        uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
-        uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        if ( vDeltas )
+        {
+            uLit1 = uLit  - (unsigned)Vec_IntEntry( vDeltas, 2*i   );
+            uLit0 = uLit1 - (unsigned)Vec_IntEntry( vDeltas, 2*i+1 );
+        }
+        else
+        {
+            uLit1 = uLit  - Gia_AigerReadUnsigned( &pCur );
+            uLit0 = uLit1 - Gia_AigerReadUnsigned( &pCur );
+        }
 //        assert( uLit1 > uLit0 );
         iNode0 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit0 >> 1), uLit0 & 1 );
         iNode1 = Abc_LitNotCond( Vec_IntEntry(vNodes, uLit1 >> 1), uLit1 & 1 );
@@ -306,6 +665,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     }
     if ( !fGiaSimple && !fSkipStrash )
         Gia_ManHashStop( pNew );
+    Vec_IntFreeP( &vDeltas );
 
     // remember the place where symbols begin
     pSymbols = pCur;
@@ -394,7 +754,7 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                 break;
             }
             // get terminal number
-            iTerm = atoi( (char *)++pCur );  while ( *pCur++ != ' ' );
+            iTerm = atoi( (char *)++pCur );  while ( *pCur != ' ' && *pCur != '\n' ) pCur++;
             // skip spaces
             while ( *pCur == ' ' )
                 pCur++;
@@ -454,7 +814,9 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
                     break;
                 }
                 // get the terminal number
-                iTerm = atoi( (char *)++pCur );  while ( *pCur++ != ' ' );
+                iTerm = atoi( (char *)++pCur );  while ( *pCur != ' ' && *pCur != '\n' ) pCur++;
+                if ( *pCur == ' ' )
+                    pCur++;
                 // get the node
                 if ( iTerm < 0 || iTerm >= nOutputs )
                 {
@@ -862,6 +1224,11 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
     return pNew;
 }
 
+Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Reads the AIG in the binary AIGER format.]
@@ -873,24 +1240,23 @@ Gia_Man_t * Gia_AigerReadFromMemory( char * pContents, int nFileSize, int fGiaSi
   SeeAlso     []
 
 ***********************************************************************/
-Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+Gia_Man_t * Gia_AigerReadPar( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck, int nThreads )
 {
-    FILE * pFile;
     Gia_Man_t * pNew;
     char * pName, * pContents;
-    int nFileSize;
-    int RetValue;
+    int nFileSize, fMapped;
 
-    // read the file into the buffer
+    // load the file into memory
     Gia_FileFixName( pFileName );
-    nFileSize = Gia_FileSize( pFileName );
-    pFile = fopen( pFileName, "rb" );
-    pContents = ABC_ALLOC( char, nFileSize );
-    RetValue = fread( pContents, nFileSize, 1, pFile );
-    fclose( pFile );
+    pContents = Gia_FileLoadContents( pFileName, &nFileSize, &fMapped );
+    if ( pContents == NULL )
+    {
+        printf( "Gia_AigerRead(): Cannot open the input file \"%s\".\n", pFileName );
+        return NULL;
+    }
 
-    pNew = Gia_AigerReadFromMemory( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck );
-    ABC_FREE( pContents );
+    pNew = Gia_AigerReadFromMemoryPar( pContents, nFileSize, fGiaSimple, fSkipStrash, fCheck, nThreads );
+    Gia_FileUnloadContents( pContents, nFileSize, fMapped );
     if ( pNew )
     {
         ABC_FREE( pNew->pName );
@@ -903,6 +1269,10 @@ Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, in
     }
     return pNew;
 }
+Gia_Man_t * Gia_AigerRead( char * pFileName, int fGiaSimple, int fSkipStrash, int fCheck )
+{
+    return Gia_AigerReadPar( pFileName, fGiaSimple, fSkipStrash, fCheck, 1 );
+}
 
 
 
@@ -1069,14 +1439,15 @@ Vec_Str_t * Gia_AigerWriteIntoMemoryStrPart( Gia_Man_t * p, Vec_Int_t * vCis, Ve
 
   Synopsis    [Writes the AIG in the binary AIGER format.]
 
-  Description []
+  Description [When several threads are given, the AND gates of large
+  AIGs are encoded in parallel (see Gia_AigerWriteAndsPar).]
   
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact )
+void Gia_AigerWritePar( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact, int nThreads )
 {
     int fVerbose = XAIG_VERBOSE;
     FILE * pFile;
@@ -1101,6 +1472,8 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         fprintf( stdout, "Gia_AigerWrite(): Cannot open the output file \"%s\".\n", pFileName );
         return;
     }
+    // use a larger buffer to reduce the number of system calls
+    setvbuf( pFile, NULL, _IOFBF, 1 << 20 );
 
     // create normalized AIG
     if ( !Gia_ManIsNormalized(pInit) )
@@ -1150,32 +1523,39 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
     }
     Gia_ManInvertConstraints( p );
 
-    // write the nodes into the buffer
-    Pos = 0;
-    nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
-    pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
-    Gia_ManForEachAnd( p, pObj, i )
+#ifdef ABC_USE_PTHREADS
+    if ( nThreads > 1 && Gia_ManAndNum(p) >= GIA_AIG_PAR_AND_MIN )
+        Gia_AigerWriteAndsPar( p, pFile, nThreads );
+    else
+#endif
     {
-        uLit  = Abc_Var2Lit( i, 0 );
-        uLit0 = Gia_ObjFaninLit0( pObj, i );
-        uLit1 = Gia_ObjFaninLit1( pObj, i );
-        assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
-        Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
-        if ( Pos > nBufferSize - 10 )
+        // write the nodes into the buffer
+        Pos = 0;
+        nBufferSize = 8 * Gia_ManAndNum(p) + 100; // skeptically assuming 3 chars per one AIG edge
+        pBuffer = ABC_ALLOC( unsigned char, nBufferSize );
+        Gia_ManForEachAnd( p, pObj, i )
         {
-            printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
-            fclose( pFile );
-            if ( p != pInit )
-                Gia_ManStop( p );
-            return;
+            uLit  = Abc_Var2Lit( i, 0 );
+            uLit0 = Gia_ObjFaninLit0( pObj, i );
+            uLit1 = Gia_ObjFaninLit1( pObj, i );
+            assert( p->fGiaSimple || Gia_ManBufNum(p) || uLit0 < uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit  - uLit1 );
+            Pos = Gia_AigerWriteUnsignedBuffer( pBuffer, Pos, uLit1 - uLit0 );
+            if ( Pos > nBufferSize - 10 )
+            {
+                printf( "Gia_AigerWrite(): AIGER generation has failed because the allocated buffer is too small.\n" );
+                fclose( pFile );
+                if ( p != pInit )
+                    Gia_ManStop( p );
+                return;
+            }
         }
-    }
-    assert( Pos < nBufferSize );
+        assert( Pos < nBufferSize );
 
-    // write the buffer
-    fwrite( pBuffer, 1, Pos, pFile );
-    ABC_FREE( pBuffer );
+        // write the buffer
+        fwrite( pBuffer, 1, Pos, pFile );
+        ABC_FREE( pBuffer );
+    }
 
     // write the symbol table
     if ( p->vNamesIn && p->vNamesOut )
@@ -1417,6 +1797,10 @@ void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int
         Gia_ManStop( p );
     }
 }
+void Gia_AigerWrite( Gia_Man_t * pInit, char * pFileName, int fWriteSymbols, int fCompact )
+{
+    Gia_AigerWritePar( pInit, pFileName, fWriteSymbols, fCompact, 1 );
+}
 
 /**Function*************************************************************
 
@@ -51,13 +51,9 @@ static inline int Gia_ManHashOne( int iLit0, int iLit1, int iLitC, int TableSize
     Key += Abc_LitIsCompl(iLit1) * 353;
     return (int)(Key % TableSize);
 }
-static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
+static inline int * Gia_ManHashFindList( Gia_Man_t * p, int * pPlace, int iLit0, int iLit1, int iLitC )
 {
-    int iThis, * pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( iLit0, iLit1, iLitC, Vec_IntSize(&p->vHTable) ) );
-    assert( Vec_IntSize(&p->vHash) == Gia_ManObjNum(p) );
-    assert( p->pMuxes || iLit0 < iLit1 );
-    assert( iLit0 < iLit1 || (!Abc_LitIsCompl(iLit0) && !Abc_LitIsCompl(iLit1)) );
-    assert( iLitC == -1 || !Abc_LitIsCompl(iLit1) );
+    int iThis;
     for ( ; (iThis = *pPlace); pPlace = Vec_IntEntryP(&p->vHash, iThis) )
     {
         Gia_Obj_t * pThis = Gia_ManObj( p, iThis );
@@ -66,6 +62,24 @@ static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iL
     }
     return pPlace;
 }
+static inline int * Gia_ManHashFind( Gia_Man_t * p, int iLit0, int iLit1, int iLitC )
+{
+    int * pPlace, * pPlaceOld, iPlaceOld;
+    assert( Vec_IntSize(&p->vHash) == Gia_ManObjNum(p) );
+    assert( p->pMuxes || iLit0 < iLit1 );
+    assert( iLit0 < iLit1 || (!Abc_LitIsCompl(iLit0) && !Abc_LitIsCompl(iLit1)) );
+    assert( iLitC == -1 || !Abc_LitIsCompl(iLit1) );
+    pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( iLit0, iLit1, iLitC, Vec_IntSize(&p->vHTable) ) );
+    pPlace = Gia_ManHashFindList( p, pPlace, iLit0, iLit1, iLitC );
+    if ( *pPlace || Vec_IntSize(&p->vHTableOld) == 0 )
+        return pPlace;
+    // the node may still be in the part of the old table that is not migrated yet
+    iPlaceOld = Gia_ManHashOne( iLit0, iLit1, iLitC, Vec_IntSize(&p->vHTableOld) );
+    if ( iPlaceOld < p->iHTableMove )
+        return pPlace;
+    pPlaceOld = Gia_ManHashFindList( p, Vec_IntEntryP(&p->vHTableOld, iPlaceOld), iLit0, iLit1, iLitC );
+    return *pPlaceOld ? pPlaceOld : pPlace;
+}
 
 /**Function*************************************************************
 
@@ -149,14 +163,58 @@ void Gia_ManHashStart( Gia_Man_t * p )
 void Gia_ManHashStop( Gia_Man_t * p )  
 {
     Vec_IntErase( &p->vHTable );
+    Vec_IntErase( &p->vHTableOld );
     Vec_IntErase( &p->vHash );
+    p->iHTableMove = 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Migrates several entries of the old table after resizing.]
+
+  Description [Moves the nodes hashed into the given number of entries 
+  of the old table into the new table. Deallocates the old table when 
+  all of its entries have been migrated.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManHashMove( Gia_Man_t * p, int nEntries )
+{
+    int iThis, iNext, * pPlace;
+    assert( Vec_IntSize(&p->vHTableOld) > 0 );
+    for ( ; nEntries > 0 && p->iHTableMove < Vec_IntSize(&p->vHTableOld); nEntries--, p->iHTableMove++ )
+    {
+        for ( iThis = Vec_IntEntry(&p->vHTableOld, p->iHTableMove); iThis; iThis = iNext )
+        {
+            Gia_Obj_t * pThis = Gia_ManObj( p, iThis );
+            iNext  = Vec_IntEntry( &p->vHash, iThis );
+            pPlace = Vec_IntEntryP( &p->vHTable, Gia_ManHashOne( Gia_ObjFaninLit0(pThis, iThis), Gia_ObjFaninLit1(pThis, iThis), Gia_ObjFaninLit2p(p, pThis), Vec_IntSize(&p->vHTable) ) );
+            // add the node at the beginning of the list
+            Vec_IntWriteEntry( &p->vHash, iThis, *pPlace );
+            *pPlace = iThis;
+        }
+        Vec_IntWriteEntry( &p->vHTableOld, p->iHTableMove, 0 );
+    }
+    if ( p->iHTableMove == Vec_IntSize(&p->vHTableOld) )
+    {
+        Vec_IntErase( &p->vHTableOld );
+        p->iHTableMove = 0;
+    }
 }
 
 /**Function*************************************************************
 
   Synopsis    [Resizes the hash table.]
 
-  Description []
+  Description [Allocates the new table and keeps the old one until its 
+  entries are migrated by Gia_ManHashMove(), which is called for a few 
+  entries at a time when new nodes are hashed. The total work is the same 
+  as rehashing all nodes at once, but it is spread over many calls, so 
+  building a large AIG does not pause at each resize. The nodes not 
+  migrated yet are found by looking them up in both tables.]
                
   SideEffects []
 
@@ -165,32 +223,18 @@ void Gia_ManHashStop( Gia_Man_t * p )
 ***********************************************************************/
 void Gia_ManHashResize( Gia_Man_t * p )
 {
-    int i, iThis, iNext, Counter, Counter2, * pPlace;
-    Vec_Int_t vOld = p->vHTable;
-    assert( Vec_IntSize(&vOld) > 0 );
-    // replace the table
+    assert( Vec_IntSize(&p->vHTable) > 0 );
+    // complete the previous migration if it is still in progress
+    if ( Vec_IntSize(&p->vHTableOld) )
+        Gia_ManHashMove( p, Vec_IntSize(&p->vHTableOld) );
+    assert( Vec_IntSize(&p->vHTableOld) == 0 );
+    // the current table becomes the old one
+    p->vHTableOld  = p->vHTable;
+    p->iHTableMove = 0;
     Vec_IntZero( &p->vHTable );
     Vec_IntFill( &p->vHTable, Abc_PrimeCudd( 2 * Gia_ManAndNum(p) ), 0 ); 
-    // rehash the entries from the old table
-    Counter = 0;
-    Vec_IntForEachEntry( &vOld, iThis, i )
-        for ( iNext = Vec_IntEntry(&p->vHash, iThis);  
-              iThis;  iThis = iNext,   
-              iNext = Vec_IntEntry(&p->vHash, iThis)  )
-        {
-            Gia_Obj_t * pThis0 = Gia_ManObj( p, iThis );
-            Vec_IntWriteEntry( &p->vHash, iThis, 0 );
-            pPlace = Gia_ManHashFind( p, Gia_ObjFaninLit0(pThis0, iThis), Gia_ObjFaninLit1(pThis0, iThis), Gia_ObjFaninLit2p(p, pThis0) );
-            assert( *pPlace == 0 ); // should not be there
-            *pPlace = iThis;
-            assert( *pPlace != 0 );
-            Counter++;
-        }
-    Counter2 = Gia_ManAndNum(p) - Gia_ManBufNum(p);
-    assert( Counter == Counter2 );
 //    if ( p->fVerbose )
-//        printf( "Resizing GIA hash table: %d -> %d.\n", Vec_IntSize(&vOld), Vec_IntSize(&p->vHTable) );
-    Vec_IntErase( &vOld );
+//        printf( "Resizing GIA hash table: %d -> %d.\n", Vec_IntSize(&p->vHTableOld), Vec_IntSize(&p->vHTable) );
 }
 
 /**Function********************************************************************
@@ -209,6 +253,8 @@ void Gia_ManHashProfile( Gia_Man_t * p )
     int iEntry;
     int i, Counter, Limit;
     printf( "Table size = %d. Entries = %d. ", Vec_IntSize(&p->vHTable), Gia_ManAndNum(p) );
+    if ( Vec_IntSize(&p->vHTableOld) )
+        printf( "Old table size = %d. Migrated = %d. ", Vec_IntSize(&p->vHTableOld), p->iHTableMove );
     printf( "Hits = %d. Misses = %d.\n", (int)p->nHashHit, (int)p->nHashMiss );
     Limit = Abc_MinInt( 1000, Vec_IntSize(&p->vHTable) );
     for ( i = 0; i < Limit; i++ )
@@ -478,6 +524,8 @@ int Gia_ManHashXorReal( Gia_Man_t * p, int iLit0, int iLit1 )
         return 0;
     if ( iLit0 == Abc_LitNot(iLit1) )
         return 1;
+    if ( Vec_IntSize(&p->vHTableOld) )
+        Gia_ManHashMove( p, 4 );
     if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
         Gia_ManHashResize( p );
     if ( iLit0 < iLit1 )
@@ -588,6 +636,8 @@ int Gia_ManHashAnd( Gia_Man_t * p, int iLit0, int iLit1 )
         assert( Vec_IntSize(&p->vHTable) == 0 );
         return Gia_ManAppendAnd( p, iLit0, iLit1 );
     }
+    if ( Vec_IntSize(&p->vHTableOld) )
+        Gia_ManHashMove( p, 4 );
     if ( (p->nObjs & 0xFF) == 0 && 2 * Vec_IntSize(&p->vHTable) < Gia_ManAndNum(p) )
         Gia_ManHashResize( p );
     if ( p->fAddStrash )
@@ -67,6 +67,7 @@ void Gia_ManSetIfParsDefault( void * pp )
     p->nCutsMax    =  8;
     p->nFlowIters  =  1;
     p->nAreaIters  =  2;
+    p->nProcs      =  0;
     p->DelayTarget = -1;
     p->Epsilon     =  (float)0.005;
     p->fPreprocess =  1;
@@ -146,6 +146,7 @@ void Gia_ManStop( Gia_Man_t * p )
     Vec_IntFree( p->vCos );
     Vec_IntErase( &p->vHash );
     Vec_IntErase( &p->vHTable );
+    Vec_IntErase( &p->vHTableOld );
     Vec_IntErase( &p->vRefs );
     ABC_FREE( p->pData2 );
     ABC_FREE( p->pTravIds );
@@ -186,7 +187,7 @@ double Gia_ManMemory( Gia_Man_t * p )
     Memory += sizeof(Gia_Obj_t) * Gia_ManObjNum(p);
     Memory += sizeof(int) * Gia_ManCiNum(p);
     Memory += sizeof(int) * Gia_ManCoNum(p);
-    Memory += sizeof(int) * Vec_IntSize(&p->vHTable);
+    Memory += sizeof(int) * (Vec_IntSize(&p->vHTable) + Vec_IntSize(&p->vHTableOld));
     Memory += sizeof(int) * Gia_ManObjNum(p) * (p->pRefs != NULL);
     Memory += Vec_IntMemory( p->vLevels );
     Memory += Vec_IntMemory( p->vCellMapping );
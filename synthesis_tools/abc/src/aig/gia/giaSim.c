@@ -21,6 +21,11 @@
 #include "gia.h"
 #include "misc/util/utilTruth.h"
 
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(ABC_SIM_NO_SIMD)
+#include <immintrin.h>
+#define GIA_SIM_USE_X86
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -36,10 +41,206 @@ unsigned * Gia_SimDataExt( Gia_ManSim_t * p, int i )    { return Gia_SimData(p,
 unsigned * Gia_SimDataCiExt( Gia_ManSim_t * p, int i )  { return Gia_SimDataCi(p, i);  }
 unsigned * Gia_SimDataCoExt( Gia_ManSim_t * p, int i )  { return Gia_SimDataCo(p, i);  }
 
+// simulation kernel computing the AND of two (possibly complemented) arrays of words
+typedef void (*Gia_SimAndFunc_t)( unsigned * pRes, unsigned * pInfo0, unsigned * pInfo1, int fCompl0, int fCompl1, int nWords );
+
+// the kernel used by the calling thread (selected on the first use)
+static ABC_THREAD_LOCAL Gia_SimAndFunc_t s_SimAndFunc = NULL;
+
+// the size of the simulation data (in bytes) evaluated at once by Gia_ManSimulateRound()
+#define GIA_SIM_BLOCK_BYTES  (1 << 18)
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Simulates the AND-gate using 64-bit words.]
+
+  Description [The complemented attributes are applied as XOR-masks,
+  which makes the inner loop branch-free. The arrays may be unaligned
+  and the result may be written in-place into one of the operands.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Gia_ManSimAndWords64( unsigned * pRes, unsigned * pInfo0, unsigned * pInfo1, int fCompl0, int fCompl1, int nWords )
+{
+    word Mask0 = (word)0 - (word)(fCompl0 != 0);
+    word Mask1 = (word)0 - (word)(fCompl1 != 0);
+    word Data0, Data1;
+    int w;
+    for ( w = 0; w + 2 <= nWords; w += 2 )
+    {
+        memcpy( &Data0, pInfo0 + w, sizeof(word) );
+        memcpy( &Data1, pInfo1 + w, sizeof(word) );
+        Data0 = (Data0 ^ Mask0) & (Data1 ^ Mask1);
+        memcpy( pRes + w, &Data0, sizeof(word) );
+    }
+    if ( w < nWords )
+        pRes[w] = (pInfo0[w] ^ (unsigned)Mask0) & (pInfo1[w] ^ (unsigned)Mask1);
+}
+
+#ifdef GIA_SIM_USE_X86
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the AND-gate using 256-bit AVX2 words.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2")))
+static void Gia_ManSimAndWordsAvx2( unsigned * pRes, unsigned * pInfo0, unsigned * pInfo1, int fCompl0, int fCompl1, int nWords )
+{
+    __m256i Mask0 = _mm256_set1_epi32( -(fCompl0 != 0) );
+    __m256i Mask1 = _mm256_set1_epi32( -(fCompl1 != 0) );
+    __m256i Data0, Data1;
+    int w;
+    for ( w = 0; w + 8 <= nWords; w += 8 )
+    {
+        Data0 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pInfo0 + w)), Mask0 );
+        Data1 = _mm256_xor_si256( _mm256_loadu_si256((__m256i *)(pInfo1 + w)), Mask1 );
+        _mm256_storeu_si256( (__m256i *)(pRes + w), _mm256_and_si256(Data0, Data1) );
+    }
+    if ( w < nWords )
+        Gia_ManSimAndWords64( pRes + w, pInfo0 + w, pInfo1 + w, fCompl0, fCompl1, nWords - w );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the AND-gate using 512-bit AVX-512 words.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx512f")))
+static void Gia_ManSimAndWordsAvx512( unsigned * pRes, unsigned * pInfo0, unsigned * pInfo1, int fCompl0, int fCompl1, int nWords )
+{
+    __m512i Mask0 = _mm512_set1_epi32( -(fCompl0 != 0) );
+    __m512i Mask1 = _mm512_set1_epi32( -(fCompl1 != 0) );
+    __m512i Data0, Data1;
+    int w;
+    for ( w = 0; w + 16 <= nWords; w += 16 )
+    {
+        Data0 = _mm512_xor_si512( _mm512_loadu_si512((void *)(pInfo0 + w)), Mask0 );
+        Data1 = _mm512_xor_si512( _mm512_loadu_si512((void *)(pInfo1 + w)), Mask1 );
+        _mm512_storeu_si512( (void *)(pRes + w), _mm512_and_si512(Data0, Data1) );
+    }
+    if ( w < nWords )
+        Gia_ManSimAndWords64( pRes + w, pInfo0 + w, pInfo1 + w, fCompl0, fCompl1, nWords - w );
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the name of the simulation kernel.]
+
+  Description [Kernels are numbered from 0 (portable 64-bit code) 
+  to 2 (AVX-512). Returns NULL if the kernel does not exist.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Gia_ManSimKernelName( int iKernel )
+{
+    if ( iKernel == 0 )
+        return "word64";
+    if ( iKernel == 1 )
+        return "avx2";
+    if ( iKernel == 2 )
+        return "avx512";
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the kernel if it is supported by this CPU.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_SimAndFunc_t Gia_ManSimKernel( int iKernel )
+{
+    if ( iKernel == 0 )
+        return Gia_ManSimAndWords64;
+#ifdef GIA_SIM_USE_X86
+    __builtin_cpu_init();
+    if ( iKernel == 1 && __builtin_cpu_supports("avx2") )
+        return Gia_ManSimAndWordsAvx2;
+    if ( iKernel == 2 && __builtin_cpu_supports("avx512f") )
+        return Gia_ManSimAndWordsAvx512;
+#endif
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the simulation kernel for the calling thread.]
+
+  Description [If iKernel is -1, selects the widest kernel supported 
+  by this CPU. Returns the number of the selected kernel, or -1 if the 
+  requested kernel is not supported (in which case nothing changes).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_ManSimKernelSelect( int iKernel )
+{
+    Gia_SimAndFunc_t pFunc;
+    if ( iKernel == -1 )
+    {
+        for ( iKernel = 2; iKernel > 0; iKernel-- )
+            if ( Gia_ManSimKernel(iKernel) )
+                break;
+    }
+    pFunc = Gia_ManSimKernel( iKernel );
+    if ( pFunc == NULL )
+        return -1;
+    s_SimAndFunc = pFunc;
+    return iKernel;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the AND-gate with the complemented fanins.]
+
+  Description [This procedure is shared by the simulators based on 
+  arrays of 32-bit words. The words are processed using the widest 
+  kernel supported by the CPU.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimAndWords( unsigned * pRes, unsigned * pInfo0, unsigned * pInfo1, int fCompl0, int fCompl1, int nWords )
+{
+    if ( s_SimAndFunc == NULL )
+        Gia_ManSimKernelSelect( -1 );
+    s_SimAndFunc( pRes, pInfo0, pInfo1, fCompl0, fCompl1, nWords );
+}
+
 
 /**Function*************************************************************
 
@@ -346,13 +547,11 @@ static inline void Gia_ManSimInfoCopy( Gia_ManSim_t * p, unsigned * pInfo, unsig
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi )
+static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iCi, int iWord, int nWords )
 {
-    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
-    unsigned * pInfo0 = Gia_SimDataCi( p, iCi );
-    int w;
-    for ( w = p->nWords-1; w >= 0; w-- )
-        pInfo[w] = pInfo0[w];
+    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) ) + iWord;
+    unsigned * pInfo0 = Gia_SimDataCi( p, iCi ) + iWord;
+    memcpy( pInfo, pInfo0, sizeof(unsigned) * nWords );
 }
 
 /**Function*************************************************************
@@ -366,17 +565,14 @@ static inline void Gia_ManSimulateCi( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iC
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pObj, int iWord, int nWords )
 {
-    unsigned * pInfo  = Gia_SimDataCo( p, iCo );
-    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
+    unsigned * pInfo  = Gia_SimDataCo( p, iCo ) + iWord;
+    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) ) + iWord;
+    unsigned Mask = 0 - (unsigned)Gia_ObjFaninC0(pObj);
     int w;
-    if ( Gia_ObjFaninC0(pObj) )
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = ~pInfo0[w];
-    else 
-        for ( w = p->nWords-1; w >= 0; w-- )
-            pInfo[w] = pInfo0[w];
+    for ( w = nWords-1; w >= 0; w-- )
+        pInfo[w] = pInfo0[w] ^ Mask;
 }
 
 /**Function*************************************************************
@@ -390,30 +586,12 @@ static inline void Gia_ManSimulateCo( Gia_ManSim_t * p, int iCo, Gia_Obj_t * pOb
   SeeAlso     []
 
 ***********************************************************************/
-static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj )
+static inline void Gia_ManSimulateNode( Gia_ManSim_t * p, Gia_Obj_t * pObj, int iWord, int nWords )
 {
-    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) );
-    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) );
-    unsigned * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) );
-    int w;
-    if ( Gia_ObjFaninC0(pObj) )
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~(pInfo0[w] | pInfo1[w]);
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = ~pInfo0[w] & pInfo1[w];
-    }
-    else 
-    {
-        if (  Gia_ObjFaninC1(pObj) )
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & ~pInfo1[w];
-        else 
-            for ( w = p->nWords-1; w >= 0; w-- )
-                pInfo[w] = pInfo0[w] & pInfo1[w];
-    }
+    unsigned * pInfo  = Gia_SimData( p, Gia_ObjValue(pObj) ) + iWord;
+    unsigned * pInfo0 = Gia_SimData( p, Gia_ObjDiff0(pObj) ) + iWord;
+    unsigned * pInfo1 = Gia_SimData( p, Gia_ObjDiff1(pObj) ) + iWord;
+    s_SimAndFunc( pInfo, pInfo0, pInfo1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), nWords );
 }
 
 /**Function*************************************************************
@@ -464,9 +642,11 @@ void Gia_ManSimInfoTransfer( Gia_ManSim_t * p )
 
 /**Function*************************************************************
 
-  Synopsis    []
+  Synopsis    [Simulates one timeframe.]
 
-  Description []
+  Description [When the simulation data of the frontier does not fit 
+  into the cache, the patterns are divided into blocks, each of them 
+  simulated by a separate pass over the objects.]
                
   SideEffects []
 
@@ -476,30 +656,40 @@ void Gia_ManSimInfoTransfer( Gia_ManSim_t * p )
 void Gia_ManSimulateRound( Gia_ManSim_t * p )
 {
     Gia_Obj_t * pObj;
-    int i, iCis = 0, iCos = 0;
+    int i, iCis, iCos, iWord, nBlock, nWords;
     assert( p->pAig->nFront > 0 );
     assert( Gia_ManConst0(p->pAig)->Value == 0 );
+    if ( s_SimAndFunc == NULL )
+        Gia_ManSimKernelSelect( -1 );
+    // the block size is a multiple of 16 words (one AVX-512 register)
+    nBlock = GIA_SIM_BLOCK_BYTES / (int)sizeof(unsigned) / p->pAig->nFront;
+    nBlock = Abc_MaxInt( 16, nBlock & ~15 );
     Gia_ManSimInfoZero( p, Gia_SimData(p, 0) );
-    Gia_ManForEachObj1( p->pAig, pObj, i )
+    for ( iWord = 0; iWord < p->nWords; iWord += nBlock )
     {
-        if ( Gia_ObjIsAndOrConst0(pObj) )
-        {
-            assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateNode( p, pObj );
-        }
-        else if ( Gia_ObjIsCo(pObj) )
-        {
-            assert( Gia_ObjValue(pObj) == GIA_NONE );
-            Gia_ManSimulateCo( p, iCos++, pObj );
-        }
-        else // if ( Gia_ObjIsCi(pObj) )
+        nWords = Abc_MinInt( nBlock, p->nWords - iWord );
+        iCis = iCos = 0;
+        Gia_ManForEachObj1( p->pAig, pObj, i )
         {
-            assert( Gia_ObjValue(pObj) < p->pAig->nFront );
-            Gia_ManSimulateCi( p, pObj, iCis++ );
+            if ( Gia_ObjIsAndOrConst0(pObj) )
+            {
+                assert( Gia_ObjValue(pObj) < p->pAig->nFront );
+                Gia_ManSimulateNode( p, pObj, iWord, nWords );
+            }
+            else if ( Gia_ObjIsCo(pObj) )
+            {
+                assert( Gia_ObjValue(pObj) == GIA_NONE );
+                Gia_ManSimulateCo( p, iCos++, pObj, iWord, nWords );
+            }
+            else // if ( Gia_ObjIsCi(pObj) )
+            {
+                assert( Gia_ObjValue(pObj) < p->pAig->nFront );
+                Gia_ManSimulateCi( p, pObj, iCis++, iWord, nWords );
+            }
         }
+        assert( Gia_ManCiNum(p->pAig) == iCis );
+        assert( Gia_ManCoNum(p->pAig) == iCos );
     }
-    assert( Gia_ManCiNum(p->pAig) == iCis );
-    assert( Gia_ManCoNum(p->pAig) == iCos );
 }
 
 /**Function*************************************************************
@@ -654,6 +844,56 @@ int Gia_ManSimSimulate( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
     return RetValue;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Measures the throughput of the simulation kernels.]
+
+  Description [Simulates the AIG for the given number of frames using 
+  each kernel supported by this CPU and prints the throughput measured 
+  in millions of pattern-node evaluations per second.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Gia_ManSimBenchmark( Gia_Man_t * pAig, Gia_ParSim_t * pPars )
+{
+    Gia_ManSim_t * p;
+    Gia_SimAndFunc_t pFuncOld = s_SimAndFunc;
+    abctime clk;
+    double Evals;
+    int i, k;
+    p = Gia_ManSimCreate( pAig, pPars );
+    if ( p == NULL )
+        return;
+    Evals = 32.0 * p->nWords * pPars->nIters * Gia_ManAndNum(pAig);
+    Abc_Print( 1, "Simulating %d frames with %d words (%.0f patterns) for %d nodes and frontier %d.\n", 
+        pPars->nIters, p->nWords, 32.0 * p->nWords * pPars->nIters, Gia_ManAndNum(pAig), p->pAig->nFront );
+    for ( k = 0; Gia_ManSimKernelName(k); k++ )
+    {
+        if ( Gia_ManSimKernelSelect( k ) == -1 )
+        {
+            Abc_Print( 1, "Kernel %-7s :  not supported by this CPU\n", Gia_ManSimKernelName(k) );
+            continue;
+        }
+        Gia_ManResetRandom( pPars );
+        Gia_ManSimInfoInit( p );
+        clk = Abc_Clock();
+        for ( i = 0; i < pPars->nIters; i++ )
+        {
+            Gia_ManSimulateRound( p );
+            if ( i < pPars->nIters - 1 )
+                Gia_ManSimInfoTransfer( p );
+        }
+        clk = Abc_MaxInt( 1, Abc_Clock() - clk );
+        Abc_Print( 1, "Kernel %-7s : %10.2f M patterns*nodes/sec  ", Gia_ManSimKernelName(k), Evals / (1.0*clk/CLOCKS_PER_SEC) / 1000000 );
+        Abc_PrintTime( 1, "Time", clk );
+    }
+    s_SimAndFunc = pFuncOld;
+    Gia_ManSimDelete( p );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -36,7 +36,7 @@ struct Aig_CuddMan_t_
 };
 
 // static Cudd AIG manager used in this experiment
-static Aig_CuddMan_t * s_pCuddMan = NULL;
+static ABC_THREAD_LOCAL Aig_CuddMan_t * s_pCuddMan = NULL;
 
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
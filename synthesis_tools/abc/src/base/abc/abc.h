@@ -191,6 +191,7 @@ struct Abc_Ntk_t_
     void *            pManFunc;      // functionality manager (AIG manager, BDD manager, or memory manager for SOPs)
     Abc_ManTime_t *   pManTime;      // the timing manager (for mapped networks) stores arrival/required times for all nodes
     void *            pManCut;       // the cut manager (for AIGs) stores information about the cuts computed for the nodes
+    void *            pManCutRwr;    // the cut manager saved by rewriting to be reused in the next call
     float             AndGateDelay;  // an average estimated delay of one AND gate
     int               LevelMax;      // maximum number of levels
     Vec_Int_t *       vLevelsR;      // level in the reverse topological order (for AIGs)
@@ -589,6 +590,8 @@ extern ABC_DLL char *             Abc_NodeConvertSopToMvSop( int nVars, Vec_Int_
 extern ABC_DLL int                Abc_NodeEvalMvCost( int nVars, Vec_Int_t * vSop0, Vec_Int_t * vSop1 );
 /*=== abcBalance.c ==========================================================*/
 extern ABC_DLL Abc_Ntk_t *        Abc_NtkBalance( Abc_Ntk_t * pNtk, int  fDuplicate, int  fSelective, int  fUpdateLevel );
+/*=== abcBalanceArith.c ==========================================================*/
+extern ABC_DLL Abc_Ntk_t *        Abc_NtkBalanceArith( Abc_Ntk_t * pNtk, int fDuplicate, int fSelective, int fUpdateLevel, int fVerbose );
 /*=== abcCheck.c ==========================================================*/
 extern ABC_DLL int                Abc_NtkCheck( Abc_Ntk_t * pNtk );
 extern ABC_DLL int                Abc_NtkCheckRead( Abc_Ntk_t * pNtk );
@@ -609,6 +612,8 @@ extern ABC_DLL void *             Abc_NodeGetCuts( void * p, Abc_Obj_t * pObj, i
 extern ABC_DLL void               Abc_NodeGetCutsSeq( void * p, Abc_Obj_t * pObj, int fFirst );
 extern ABC_DLL void *             Abc_NodeReadCuts( void * p, Abc_Obj_t * pObj );
 extern ABC_DLL void               Abc_NodeFreeCuts( void * p, Abc_Obj_t * pObj );
+extern ABC_DLL void               Abc_NtkRemapCuts( void * p, Abc_Ntk_t * pNtk );
+extern ABC_DLL int                Abc_NtkUpdateCuts( void * p, Abc_Ntk_t * pNtk );
 /*=== abcDar.c ============================================================*/
 extern ABC_DLL int                Abc_NtkPhaseFrameNum( Abc_Ntk_t * pNtk );
 extern ABC_DLL int                Abc_NtkDarPrintCone( Abc_Ntk_t * pNtk );
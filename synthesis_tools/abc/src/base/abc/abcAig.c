@@ -568,6 +568,8 @@ void Abc_AigAndDelete( Abc_Aig_t * pMan, Abc_Obj_t * pThis )
     // delete the cuts if defined
     if ( pThis->pNtk->pManCut )
         Abc_NodeFreeCuts( pThis->pNtk->pManCut, pThis );
+    else if ( pThis->pNtk->pManCutRwr )
+        Abc_NodeFreeCuts( pThis->pNtk->pManCutRwr, pThis );
 }
 
 /**Function*************************************************************
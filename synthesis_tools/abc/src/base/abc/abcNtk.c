@@ -23,6 +23,7 @@
 #include "base/main/main.h"
 #include "map/mio/mio.h"
 #include "aig/gia/gia.h"
+#include "opt/cut/cut.h"
 
 #ifdef ABC_USE_CUDD
 #include "bdd/extrab/extraBdd.h"
@@ -1357,6 +1358,9 @@ void Abc_NtkDelete( Abc_Ntk_t * pNtk )
     // free the timing manager
     if ( pNtk->pManTime )
         Abc_ManTimeStop( pNtk->pManTime );
+    // free the cut manager saved by rewriting
+    if ( pNtk->pManCutRwr )
+        Cut_ManStop( (Cut_Man_t *)pNtk->pManCutRwr );
     Vec_IntFreeP( &pNtk->vPhases );
     // start the functionality manager
     if ( Abc_NtkIsStrash(pNtk) )
@@ -1868,6 +1868,10 @@ void Abc_NtkReassignIds( Abc_Ntk_t * pNtk )
             pNode->vFanouts.pArray[k] = pTemp->Id;
     }
 
+    // transfer the cuts saved by rewriting
+    if ( pNtk->pManCutRwr )
+        Abc_NtkRemapCuts( pNtk->pManCutRwr, pNtk );
+
     // replace the array of objs
     Vec_PtrFree( pNtk->vObjs );
     pNtk->vObjs = vObjsNew;
@@ -1279,6 +1279,10 @@ void Abc_End( Abc_Frame_t * pAbc )
         extern void Dar_LibStop();
         Dar_LibStop();
     }
+    {
+        extern void Rwr_LibStop();
+        Rwr_LibStop();
+    }
     {
         extern void Aig_RManQuit();
         Aig_RManQuit();
@@ -1292,6 +1296,8 @@ void Abc_End( Abc_Frame_t * pAbc )
         Sdm_ManQuit();
     }
     Abc_NtkFraigStoreClean();
+    if ( Cmd_FlagReadByName(pAbc, "dsd_cache") && Abc_FrameReadManDsd() && pAbc->fManDsdCache )
+        If_DsdManSave( (If_DsdMan_t *)Abc_FrameReadManDsd(), Cmd_FlagReadByName(pAbc, "dsd_cache") );
     Gia_ManStopP( &pAbc->pGia );
     Gia_ManStopP( &pAbc->pGia2 );
     Gia_ManStopP( &pAbc->pGiaBest );
@@ -3576,6 +3582,7 @@ int Abc_CommandBalance( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fSelective;
     int fUpdateLevel;
     int fExor;
+    int fArith;
     int fVerbose;
     pNtk = Abc_FrameReadNtk(pAbc);
 
@@ -3584,9 +3591,10 @@ int Abc_CommandBalance( Abc_Frame_t * pAbc, int argc, char ** argv )
     fSelective   = 0;
     fUpdateLevel = 1;
     fExor        = 0;
+    fArith       = 0;
     fVerbose     = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "ldsxvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "ldsxmvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -3602,6 +3610,9 @@ int Abc_CommandBalance( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'x':
             fExor ^= 1;
             break;
+        case 'm':
+            fArith ^= 1;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -3620,7 +3631,9 @@ int Abc_CommandBalance( Abc_Frame_t * pAbc, int argc, char ** argv )
     // get the new network
     if ( Abc_NtkIsStrash(pNtk) )
     {
-        if ( fExor )
+        if ( fArith )
+            pNtkRes = Abc_NtkBalanceArith( pNtk, fDuplicate, fSelective, fUpdateLevel, fVerbose );
+        else if ( fExor )
             pNtkRes = Abc_NtkBalanceExor( pNtk, fUpdateLevel, fVerbose );
         else
             pNtkRes = Abc_NtkBalance( pNtk, fDuplicate, fSelective, fUpdateLevel );
@@ -3633,7 +3646,9 @@ int Abc_CommandBalance( Abc_Frame_t * pAbc, int argc, char ** argv )
             Abc_Print( -1, "Strashing before balancing has failed.\n" );
             return 1;
         }
-        if ( fExor )
+        if ( fArith )
+            pNtkRes = Abc_NtkBalanceArith( pNtkTemp, fDuplicate, fSelective, fUpdateLevel, fVerbose );
+        else if ( fExor )
             pNtkRes = Abc_NtkBalanceExor( pNtkTemp, fUpdateLevel, fVerbose );
         else
             pNtkRes = Abc_NtkBalance( pNtkTemp, fDuplicate, fSelective, fUpdateLevel );
@@ -3651,12 +3666,13 @@ int Abc_CommandBalance( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: balance [-ldsxvh]\n" );
+    Abc_Print( -2, "usage: balance [-ldsxmvh]\n" );
     Abc_Print( -2, "\t        transforms the current network into a well-balanced AIG\n" );
     Abc_Print( -2, "\t-l    : toggle minimizing the number of levels [default = %s]\n", fUpdateLevel? "yes": "no" );
     Abc_Print( -2, "\t-d    : toggle duplication of logic [default = %s]\n", fDuplicate? "yes": "no" );
     Abc_Print( -2, "\t-s    : toggle duplication on the critical paths [default = %s]\n", fSelective? "yes": "no" );
     Abc_Print( -2, "\t-x    : toggle balancing multi-input EXORs [default = %s]\n", fExor? "yes": "no" );
+    Abc_Print( -2, "\t-m    : toggle balancing XOR/MUX/MAJ supergates and carry chains [default = %s]\n", fArith? "yes": "no" );
     Abc_Print( -2, "\t-v    : print verbose information [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h    : print the command usage\n");
     return 1;
@@ -4178,15 +4194,16 @@ usage:
 ***********************************************************************/
 int Abc_CommandFastExtract( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
-    extern int Abc_NtkFxPerform( Abc_Ntk_t * pNtk, int nNewNodesMax, int nLitCountMax, int fCanonDivs, int fVerbose, int fVeryVerbose );
+    extern int Abc_NtkFxPerform( Abc_Ntk_t * pNtk, int nNewNodesMax, int nLitCountMax, int fCanonDivs, int nThreads, int fVerbose, int fVeryVerbose );
     Abc_Ntk_t * pNtk = Abc_FrameReadNtk(pAbc);
     Fxu_Data_t Params, * p = &Params;
     int c, fNewAlgo = 1;
     int nPairsLimit = 1000000000;
+    int nThreads = 1;
     // set the defaults
     Abc_NtkSetDefaultFxParams( p );
     Extra_UtilGetoptReset();
-    while ( (c = Extra_UtilGetopt(argc, argv, "SDNWMPsdzcnxvwh")) != EOF )
+    while ( (c = Extra_UtilGetopt(argc, argv, "SDNWMPJsdzcnxvwh")) != EOF )
     {
         switch (c)
         {
@@ -4256,6 +4273,17 @@ int Abc_CommandFastExtract( Abc_Frame_t * pAbc, int argc, char ** argv )
                 if ( nPairsLimit < 0 )
                     goto usage;
                 break;
+            case 'J':
+                if ( globalUtilOptind >= argc )
+                {
+                    Abc_Print( -1, "Command line switch \"-J\" should be followed by an integer.\n" );
+                    goto usage;
+                }
+                nThreads = atoi(argv[globalUtilOptind]);
+                globalUtilOptind++;
+                if ( nThreads < 1 )
+                    goto usage;
+                break;
             case 's':
                 p->fOnlyS ^= 1;
                 break;
@@ -4315,14 +4343,14 @@ int Abc_CommandFastExtract( Abc_Frame_t * pAbc, int argc, char ** argv )
 
     // the nodes to be merged are linked into the special linked list
     if ( fNewAlgo )
-        Abc_NtkFxPerform( pNtk, p->nNodesExt, p->LitCountMax, p->fCanonDivs, p->fVerbose, p->fVeryVerbose );
+        Abc_NtkFxPerform( pNtk, p->nNodesExt, p->LitCountMax, p->fCanonDivs, nThreads, p->fVerbose, p->fVeryVerbose );
     else
         Abc_NtkFastExtract( pNtk, p );
     Abc_NtkFxuFreeInfo( p );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: fx [-SDNWMP <num>] [-sdzcnxvwh]\n");
+    Abc_Print( -2, "usage: fx [-SDNWMPJ <num>] [-sdzcnxvwh]\n");
     Abc_Print( -2, "\t           performs unate fast extract on the current network\n");
     Abc_Print( -2, "\t-S <num> : max number of single-cube divisors to consider [default = %d]\n", p->nSingleMax );
     Abc_Print( -2, "\t-D <num> : max number of double-cube divisors to consider [default = %d]\n", p->nPairsMax );
@@ -4330,6 +4358,7 @@ usage:
     Abc_Print( -2, "\t-W <num> : lower bound on the weight of divisors to extract [default = %d]\n", p->WeightMin );
     Abc_Print( -2, "\t-M <num> : upper bound on literal count of divisors to extract [default = %d]\n", p->LitCountMax );
     Abc_Print( -2, "\t-P <num> : skip \"fx\" if cube pair count exceeds this limit [default = %d]\n", nPairsLimit );
+    Abc_Print( -2, "\t-J <num> : the number of threads to count divisors (new implementation) [default = %d]\n", nThreads );
     Abc_Print( -2, "\t-s       : use only single-cube divisors [default = %s]\n", p->fOnlyS? "yes": "no" );
     Abc_Print( -2, "\t-d       : use only double-cube divisors [default = %s]\n", p->fOnlyD? "yes": "no" );
     Abc_Print( -2, "\t-z       : use zero-weight divisors [default = %s]\n", p->fUse0? "yes": "no" );
@@ -5307,7 +5336,7 @@ int Abc_CommandMfs2( Abc_Frame_t * pAbc, int argc, char ** argv )
     // set defaults
     Sfm_ParSetDefault( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "WFDMLCZNIdaeijvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WFDMLCZNIJdaeijvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -5399,6 +5428,17 @@ int Abc_CommandMfs2( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nNodesMax < 0 )
                 goto usage;
             break;
+        case 'J':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-J\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 1 )
+                goto usage;
+            break;
         case 'I':
             if ( globalUtilOptind >= argc )
             {
@@ -5496,7 +5536,7 @@ int Abc_CommandMfs2( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: mfs2 [-WFDMLCZNI <num>] [-daeijvwh]\n" );
+    Abc_Print( -2, "usage: mfs2 [-WFDMLCZNIJ <num>] [-daeijvwh]\n" );
     Abc_Print( -2, "\t           performs don't-care-based optimization of logic networks\n" );
     Abc_Print( -2, "\t-W <num> : the number of levels in the TFO cone (0 <= num) [default = %d]\n",             pPars->nTfoLevMax );
     Abc_Print( -2, "\t-F <num> : the max number of fanouts to skip (1 <= num) [default = %d]\n",                pPars->nFanoutMax );
@@ -5506,6 +5546,7 @@ usage:
     Abc_Print( -2, "\t-C <num> : the max number of conflicts in one SAT run (0 = no limit) [default = %d]\n",   pPars->nBTLimit );
     Abc_Print( -2, "\t-Z <num> : treat the first <num> logic nodes as fixed (0 = none) [default = %d]\n",       pPars->nFirstFixed );
     Abc_Print( -2, "\t-N <num> : the max number of nodes to try (0 = all) [default = %d]\n",                    pPars->nNodesMax );
+    Abc_Print( -2, "\t-J <num> : the number of threads used to evaluate windows [default = %d]\n",              pPars->nProcs );
     Abc_Print( -2, "\t-d       : toggle performing redundancy removal [default = %s]\n",                        pPars->fRrOnly? "yes": "no" );
     Abc_Print( -2, "\t-a       : toggle minimizing area or area+edges [default = %s]\n",                        pPars->fArea? "area": "area+edges" );
     Abc_Print( -2, "\t-e       : toggle high-effort resubstitution [default = %s]\n",                           pPars->fMoreEffort? "yes": "no" );
@@ -6791,6 +6832,7 @@ usage:
     Abc_Print( -2, "\t               6: new phase canonical form\n" );
     Abc_Print( -2, "\t               7: new hierarchical matching\n" );
     Abc_Print( -2, "\t               8: hierarchical matching by XueGong Zhou at Fudan University, Shanghai\n" );
+    Abc_Print( -2, "\t               9: exact NPN canonical form by pruned enumeration (up to 6 inputs)\n" );
     Abc_Print( -2, "\t-N <num> : the number of support variables (binary files only) [default = unused]\n" );
     Abc_Print( -2, "\t-d       : toggle dumping resulting functions into a file [default = %s]\n", fDumpRes? "yes": "no" );
     Abc_Print( -2, "\t-b       : toggle dumping in binary format [default = %s]\n", fBinary? "yes": "no" );
@@ -18036,6 +18078,49 @@ usage:
 }
 #endif
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the DSD manager used by the mapper.]
+
+  Description [If the flag "dsd_cache" is set to a file name (for example, 
+  in abc.rc), the manager is loaded from this file, provided that it exists 
+  and is compatible with the mapping parameters. The manager is written 
+  back into this file when the program terminates, unless the file exists 
+  but could not be loaded or is not compatible, in which case *pfCache is 
+  set to 0 and the file is left unchanged.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static If_DsdMan_t * Abc_FrameStartManDsd( Abc_Frame_t * pAbc, int nVars, int LutSize, int * pfCache )
+{
+    char * pFileName = Cmd_FlagReadByName( pAbc, "dsd_cache" );
+    If_DsdMan_t * p = NULL;
+    FILE * pFile;
+    *pfCache = (pFileName != NULL);
+    if ( pFileName && (pFile = fopen(pFileName, "rb")) )
+    {
+        fclose( pFile );
+        p = If_DsdManLoad( pFileName );
+        if ( p == NULL )
+        {
+            printf( "DSD manager in file \"%s\" cannot be loaded. The file will not be overwritten.\n", pFileName );
+            *pfCache = 0;
+        }
+        else if ( nVars > If_DsdManVarNum(p) || LutSize != If_DsdManLutSize(p) )
+        {
+            printf( "DSD manager in file \"%s\" is not compatible with the current parameters and is not used.\n", pFileName );
+            printf( "The file will not be overwritten.\n" );
+            If_DsdManFree( p, 0 );
+            p = NULL;
+            *pfCache = 0;
+        }
+    }
+    return p ? p : If_DsdManAlloc( nVars, LutSize );
+}
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -18058,7 +18143,7 @@ int Abc_CommandIf( Abc_Frame_t * pAbc, int argc, char ** argv )
     If_ManSetDefaultPars( pPars );
     pPars->pLutLib = (If_LibLut_t *)Abc_FrameReadLibLut();
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRNTXYDEWSqaflepmrsdbgxyuojiktncvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRNTXYJDEWSqaflepmrsdbgxyuojiktncvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -18174,6 +18259,17 @@ int Abc_CommandIf( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nAndDelay < 0 )
                 goto usage;
             break;
+        case 'J':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-J\" should be followed by a non-negative integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 0 )
+                goto usage;
+            break;
         case 'D':
             if ( globalUtilOptind >= argc )
             {
@@ -18465,12 +18561,14 @@ int Abc_CommandIf( Abc_Frame_t * pAbc, int argc, char ** argv )
         }
         if ( p == NULL )
         {
+            int fCache;
             if ( LutSize > DAU_MAX_VAR || pPars->nLutSize > DAU_MAX_VAR )
             {
                 printf( "Size of required DSD manager (%d) exceeds the precompiled limit (%d) (change parameter DAU_MAX_VAR).\n", LutSize, DAU_MAX_VAR );
                 return 0;
             }
-            Abc_FrameSetManDsd( If_DsdManAlloc(pPars->nLutSize, LutSize) );
+            Abc_FrameSetManDsd( Abc_FrameStartManDsd(pAbc, pPars->nLutSize, LutSize, &fCache) );
+            pAbc->fManDsdCache = fCache;
         }
     }
 
@@ -18564,7 +18662,7 @@ usage:
         sprintf(LutSize, "library" );
     else
         sprintf(LutSize, "%d", pPars->nLutSize );
-    Abc_Print( -2, "usage: if [-KCFAGRNTXY num] [-DEW float] [-S str] [-qarlepmsdbgxyuojiktncvh]\n" );
+    Abc_Print( -2, "usage: if [-KCFAGRNTXYJ num] [-DEW float] [-S str] [-qarlepmsdbgxyuojiktncvh]\n" );
     Abc_Print( -2, "\t           performs FPGA technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : the number of LUT inputs (2 < num < %d) [default = %s]\n", IF_MAX_LUTSIZE+1, LutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (0 < num < 2^12) [default = %d]\n", pPars->nCutsMax );
@@ -18576,6 +18674,8 @@ usage:
     Abc_Print( -2, "\t-T num   : the type of LUT structures [default = any]\n" );
     Abc_Print( -2, "\t-X num   : delay of AND-gate in LUT library units [default = %d]\n", pPars->nAndDelay );
     Abc_Print( -2, "\t-Y num   : area of AND-gate in LUT library units [default = %d]\n", pPars->nAndArea );
+    Abc_Print( -2, "\t-J num   : the number of threads used to compute cuts level by level;\n" );
+    Abc_Print( -2, "\t           0 = node-by-node order (the result may differ from J > 0) [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-D float : sets the delay constraint for the mapping [default = %s]\n", Buffer );
     Abc_Print( -2, "\t-E float : sets epsilon used for tie-breaking [default = %f]\n", pPars->Epsilon );
     Abc_Print( -2, "\t-W float : sets wire delay between adjects LUTs [default = %f]\n", pPars->WireDelay );
@@ -18875,6 +18975,9 @@ int Abc_CommandDsdLoad( Abc_Frame_t * pAbc, int argc, char ** argv )
 usage:
     Abc_Print( -2, "usage: dsd_load [-bh] <file>\n" );
     Abc_Print( -2, "\t         loads DSD manager from file\n");
+    Abc_Print( -2, "\t         (after \"set dsd_cache <file>\", the manager is loaded from <file>\n");
+    Abc_Print( -2, "\t         when the mapper needs it and saved there when ABC quits, unless\n");
+    Abc_Print( -2, "\t         <file> exists but could not be loaded or does not match the mapper)\n");
     Abc_Print( -2, "\t-b     : toggles processing second manager [default = %s]\n", fSecond? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     Abc_Print( -2, "\t<file> : file name to read\n");
@@ -23242,13 +23345,17 @@ int Abc_CommandCec( Abc_Frame_t * pAbc, int argc, char ** argv )
     int nPartSize;
     int nConfLimit;
     int nInsLimit;
+    int nProcs;
     int fPartition;
     int fIgnoreNames;
+    int fArith;
 
     extern void Abc_NtkCecSat( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nConfLimit, int nInsLimit );
     extern void Abc_NtkCecFraig( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nSeconds, int fVerbose );
     extern void Abc_NtkCecFraigPart( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nSeconds, int nPartSize, int fVerbose );
     extern void Abc_NtkCecFraigPartAuto( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nSeconds, int fVerbose );
+    extern void Abc_NtkCecParallel( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nSeconds, int nConfLimit, int nProcs, int fVerbose );
+    extern int  Abc_NtkCecArith( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int fVerbose );
 
     pNtk = Abc_FrameReadNtk(pAbc);
     // set defaults
@@ -23258,10 +23365,12 @@ int Abc_CommandCec( Abc_Frame_t * pAbc, int argc, char ** argv )
     nPartSize  = 0;
     nConfLimit = 10000;
     nInsLimit  = 0;
+    nProcs     = 1;
     fPartition = 0;
     fIgnoreNames = 0;
+    fArith     = 0;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "TCIPpsnvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "TCIPJpsnavh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -23309,6 +23418,17 @@ int Abc_CommandCec( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( nPartSize < 0 )
                 goto usage;
             break;
+        case 'J':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-J\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 )
+                goto usage;
+            break;
         case 'p':
             fPartition ^= 1;
             break;
@@ -23318,6 +23438,9 @@ int Abc_CommandCec( Abc_Frame_t * pAbc, int argc, char ** argv )
         case 'n':
             fIgnoreNames ^= 1;
             break;
+        case 'a':
+            fArith ^= 1;
+            break;
         case 'v':
             fVerbose ^= 1;
             break;
@@ -23353,6 +23476,14 @@ int Abc_CommandCec( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_NtkShortNames( pNtk2 );
     }
 
+    // try algebraic rewriting if the networks look arithmetic
+    if ( fArith && Abc_NtkCecArith( pNtk1, pNtk2, fVerbose ) )
+    {
+        if ( fDelete1 ) Abc_NtkDelete( pNtk1 );
+        if ( fDelete2 ) Abc_NtkDelete( pNtk2 );
+        return 0;
+    }
+
     // perform equivalence checking
     if ( fPartition )
         Abc_NtkCecFraigPartAuto( pNtk1, pNtk2, nSeconds, fVerbose );
@@ -23360,6 +23491,8 @@ int Abc_CommandCec( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_NtkCecFraigPart( pNtk1, pNtk2, nSeconds, nPartSize, fVerbose );
     else if ( fSat )
         Abc_NtkCecSat( pNtk1, pNtk2, nConfLimit, nInsLimit );
+    else if ( nProcs > 1 )
+        Abc_NtkCecParallel( pNtk1, pNtk2, nSeconds, nConfLimit, nProcs, fVerbose );
     else
         Abc_NtkCecFraig( pNtk1, pNtk2, nSeconds, fVerbose );
 
@@ -23372,15 +23505,17 @@ usage:
         strcpy( Buffer, "unused" );
     else
         sprintf(Buffer, "%d", nPartSize );
-    Abc_Print( -2, "usage: cec [-T num] [-C num] [-I num] [-P num] [-psnvh] <file1> <file2>\n" );
+    Abc_Print( -2, "usage: cec [-T num] [-C num] [-I num] [-P num] [-J num] [-psnavh] <file1> <file2>\n" );
     Abc_Print( -2, "\t         performs combinational equivalence checking\n" );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", nSeconds );
     Abc_Print( -2, "\t-C num : limit on the number of conflicts [default = %d]\n",    nConfLimit );
     Abc_Print( -2, "\t-I num : limit on the number of clause inspections [default = %d]\n", nInsLimit );
     Abc_Print( -2, "\t-P num : partition size for multi-output networks [default = %s]\n", Buffer );
+    Abc_Print( -2, "\t-J num : the number of threads for parallel SAT sweeping [default = %d]\n", nProcs );
     Abc_Print( -2, "\t-p     : toggle automatic partitioning [default = %s]\n", fPartition? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggle \"SAT only\" and \"FRAIG + SAT\" [default = %s]\n", fSat? "SAT only": "FRAIG + SAT" );
     Abc_Print( -2, "\t-n     : toggle how CIs/COs are matched (by name or by order) [default = %s]\n", fIgnoreNames? "by order": "by name" );
+    Abc_Print( -2, "\t-a     : toggle trying algebraic rewriting for arithmetic circuits [default = %s]\n", fArith? "yes": "no" );
     Abc_Print( -2, "\t-v     : toggle verbose output [default = %s]\n", fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     Abc_Print( -2, "\tfile1  : (optional) the file with the first network\n");
@@ -24828,9 +24963,9 @@ int Abc_CommandSatoko( Abc_Frame_t * pAbc, int argc, char ** argv )
 
 usage:
 #ifdef SATOKO_ACT_VAR_FIXED
-    Abc_Print( -2, "usage: satoko [-CPDEFGHIJKLMNOQRSTU num] [-hv]<file>.cnf\n" );
+    Abc_Print( -2, "usage: satoko [-CPDEFGHIJKLMNOQRSTUABX num] [-hv]<file>.cnf\n" );
 #else
-    Abc_Print( -2, "usage: satoko [-CPDEFGHIJKLMNOQRS num] [-hv]<file>.cnf\n" );
+    Abc_Print( -2, "usage: satoko [-CPDEFGHIJKLMNOQRSABX num] [-hv]<file>.cnf\n" );
 #endif
     Abc_Print( -2, "\t-C num : limit on the number of conflicts [default = %d]\n", opts.conf_limit );
     Abc_Print( -2, "\t-P num : limit on the number of propagations [default = %d]\n", opts.conf_limit );
@@ -24857,6 +24992,10 @@ usage:
     Abc_Print( -2, "\t-T num : Variable activity limit valeu [default = 0x%08X]\n", opts.var_act_limit );
     Abc_Print( -2, "\t-U num : Variable activity re-scale factor [default = 0x%08X]\n", opts.var_act_rescale );
 #endif
+    Abc_Print( -2, "\n\tConstants used for inprocessing:\n");
+    Abc_Print( -2, "\t-A num : N.of conflicts between inprocessing rounds (0 = no inprocessing) [default = %d]\n", opts.n_conf_inprocess );
+    Abc_Print( -2, "\t-B num : Max clause size used for subsumption (0 = no subsumption) [default = %d]\n", opts.clause_max_sz_subsume );
+    Abc_Print( -2, "\t-X num : Max LBD of a learnt clause to be vivified (0 = no vivification) [default = %d]\n", opts.clause_max_lbd_vivify );
     Abc_Print( -2, "\n\t-v     : prints verbose information [default = %s]\n", opts.verbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
     return 1;
@@ -28968,11 +29107,23 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fVerbose = 0;
     int fGiaSimple = 0;
     int fSkipStrash = 0;
+    int nProcs = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "csmlvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Jcsmlvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'J':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-J\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 )
+                goto usage;
+            break;
         case 'c':
             fGiaSimple ^= 1;
             break;
@@ -29023,14 +29174,15 @@ int Abc_CommandAbc9Read( Abc_Frame_t * pAbc, int argc, char ** argv )
 //    else if ( Extra_FileIsType( FileName, ".v", NULL, NULL ) )
 //        Abc3_ReadShowHie( FileName, fSkipStrash );
     else
-        pAig = Gia_AigerRead( FileName, fGiaSimple, fSkipStrash, 0 );
+        pAig = Gia_AigerReadPar( FileName, fGiaSimple, fSkipStrash, 0, nProcs );
     if ( pAig )
         Abc_FrameUpdateGia( pAbc, pAig );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &r [-csmlvh] <file>\n" );
+    Abc_Print( -2, "usage: &r [-J num] [-csmlvh] <file>\n" );
     Abc_Print( -2, "\t         reads the current AIG from the AIGER file\n" );
+    Abc_Print( -2, "\t-J num : the number of threads used to decode AND gates [default = %d]\n", nProcs );
     Abc_Print( -2, "\t-c     : toggles reading simple AIG [default = %s]\n", fGiaSimple? "yes": "no" );
     Abc_Print( -2, "\t-s     : toggles structural hashing while reading [default = %s]\n", !fSkipStrash? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggles reading MiniAIG rather than AIGER file [default = %s]\n", fMiniAig? "yes": "no" );
@@ -30004,11 +30156,23 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
     int fMiniAig = 0;
     int fMiniLut = 0;
     int fVerbose = 0;
+    int nProcs = 1;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "upmlvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "Jupmlvh" ) ) != EOF )
     {
         switch ( c )
         {
+        case 'J':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-J\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 )
+                goto usage;
+            break;
         case 'u':
             fUnique ^= 1;
             break;
@@ -30056,12 +30220,13 @@ int Abc_CommandAbc9Write( Abc_Frame_t * pAbc, int argc, char ** argv )
     else if ( fMiniLut )
         Gia_ManWriteMiniLut( pAbc->pGia, pFileName );
     else
-        Gia_AigerWrite( pAbc->pGia, pFileName, 0, 0 );
+        Gia_AigerWritePar( pAbc->pGia, pFileName, 0, 0, nProcs );
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &w [-upmlvh] <file>\n" );
+    Abc_Print( -2, "usage: &w [-J num] [-upmlvh] <file>\n" );
     Abc_Print( -2, "\t         writes the current AIG into the AIGER file\n" );
+    Abc_Print( -2, "\t-J num : the number of threads used to encode AND gates [default = %d]\n", nProcs );
     Abc_Print( -2, "\t-u     : toggle writing canonical AIG structure [default = %s]\n", fUnique? "yes" : "no" );
     Abc_Print( -2, "\t-p     : toggle writing Verilog with 'and' and 'not' [default = %s]\n", fVerilog? "yes" : "no" );
     Abc_Print( -2, "\t-m     : toggle writing MiniAIG rather than AIGER [default = %s]\n", fMiniAig? "yes" : "no" );
@@ -31259,10 +31424,10 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     Gia_ParSim_t Pars, * pPars = &Pars;
     char * pFileName = NULL;
-    int c;
+    int c, fBenchmark = 0;
     Gia_ManSimSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "FWNTImvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "FWNTIbmvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -31321,6 +31486,9 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pFileName == NULL )
                 goto usage;
             break;
+        case 'b':
+            fBenchmark ^= 1;
+            break;
         case 'm':
             pPars->fCheckMiter ^= 1;
             break;
@@ -31338,6 +31506,11 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
         Abc_Print( -1, "Abc_CommandAbc9Sim(): There is no AIG.\n" );
         return 1;
     }
+    if ( fBenchmark )
+    {
+        Gia_ManSimBenchmark( pAbc->pGia, pPars );
+        return 0;
+    }
     if ( Gia_ManRegNum(pAbc->pGia) == 0 )
     {
         Abc_Print( -1, "The network is combinational.\n" );
@@ -31366,13 +31539,14 @@ int Abc_CommandAbc9Sim( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &sim [-FWNT num] [-mvh] -I <file>\n" );
+    Abc_Print( -2, "usage: &sim [-FWNT num] [-bmvh] -I <file>\n" );
     Abc_Print( -2, "\t         performs random simulation of the sequential miter\n" );
     Abc_Print( -2, "\t         (if candidate equivalences are defined, performs refinement)\n" );
     Abc_Print( -2, "\t-F num : the number of frames to simulate [default = %d]\n", pPars->nIters );
     Abc_Print( -2, "\t-W num : the number of words to simulate [default = %d]\n", pPars->nWords );
     Abc_Print( -2, "\t-N num : random number seed (1 <= num <= 1000) [default = %d]\n", pPars->RandSeed );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-b     : toggle measuring the throughput of simulation kernels [default = %s]\n", fBenchmark? "yes": "no" );
     Abc_Print( -2, "\t-m     : toggle miter vs. any circuit [default = %s]\n", pPars->fCheckMiter? "miter": "circuit" );
     Abc_Print( -2, "\t-v     : toggle printing verbose information [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h     : print the command usage\n");
@@ -35051,7 +35225,7 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
     int c, nArgcNew, fMiter = 0, fDualOutput = 0, fDumpMiter = 0;
     Cec_ManCecSetDefaultParams( pPars );
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CTnmdasvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CTJnmdasvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -35077,6 +35251,17 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->TimeLimit < 0 )
                 goto usage;
             break;
+        case 'J':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-J\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs <= 0 )
+                goto usage;
+            break;
         case 'n':
             pPars->fNaive ^= 1;
             break;
@@ -35226,10 +35411,11 @@ int Abc_CommandAbc9Cec( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &cec [-CT num] [-nmdasvh]\n" );
+    Abc_Print( -2, "usage: &cec [-CTJ num] [-nmdasvh]\n" );
     Abc_Print( -2, "\t         new combinational equivalence checker\n" );
     Abc_Print( -2, "\t-C num : the max number of conflicts at a node [default = %d]\n", pPars->nBTLimit );
     Abc_Print( -2, "\t-T num : approximate runtime limit in seconds [default = %d]\n", pPars->TimeLimit );
+    Abc_Print( -2, "\t-J num : the number of threads for parallel SAT sweeping [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-n     : toggle using naive SAT-based checking [default = %s]\n", pPars->fNaive? "yes":"no");
     Abc_Print( -2, "\t-m     : toggle miter vs. two circuits [default = %s]\n", fMiter? "miter":"two circuits");
     Abc_Print( -2, "\t-d     : toggle using dual output miter [default = %s]\n", fDualOutput? "yes":"no");
@@ -36095,7 +36281,7 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
     }
     pPars->pLutLib = (If_LibLut_t *)pAbc->pLibLut;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRDEWSTXYqalepmrsdbgxyofuijkztncvh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "KCFAGRDEWSTXYJqalepmrsdbgxyofuijkztncvh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -36200,6 +36386,17 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nAndDelay < 0 )
                 goto usage;
             break;
+        case 'J':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-J\" should be followed by a non-negative integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 0 )
+                goto usage;
+            break;
         case 'D':
             if ( globalUtilOptind >= argc )
             {
@@ -36542,12 +36739,14 @@ int Abc_CommandAbc9If( Abc_Frame_t * pAbc, int argc, char ** argv )
         }
         if ( p == NULL )
         {
+            int fCache;
             if ( LutSize > DAU_MAX_VAR || pPars->nLutSize > DAU_MAX_VAR )
             {
                 printf( "Size of required DSD manager (%d) exceeds the precompiled limit (%d) (change parameter DAU_MAX_VAR).\n", LutSize, DAU_MAX_VAR );
                 return 0;
             }
-            Abc_FrameSetManDsd( If_DsdManAlloc(pPars->nLutSize, LutSize) );
+            Abc_FrameSetManDsd( Abc_FrameStartManDsd(pAbc, pPars->nLutSize, LutSize, &fCache) );
+            pAbc->fManDsdCache = fCache;
         }
     }
 
@@ -36596,7 +36795,7 @@ usage:
         sprintf(LutSize, "library" );
     else
         sprintf(LutSize, "%d", pPars->nLutSize );
-    Abc_Print( -2, "usage: &if [-KCFAGRTXY num] [-DEW float] [-S str] [-qarlepmsdbgxyofuijkztnchv]\n" );
+    Abc_Print( -2, "usage: &if [-KCFAGRTXYJ num] [-DEW float] [-S str] [-qarlepmsdbgxyofuijkztnchv]\n" );
     Abc_Print( -2, "\t           performs FPGA technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : the number of LUT inputs (2 < num < %d) [default = %s]\n", IF_MAX_LUTSIZE+1, LutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (0 < num < 2^12) [default = %d]\n", pPars->nCutsMax );
@@ -36607,6 +36806,8 @@ usage:
     Abc_Print( -2, "\t-T num   : the type of LUT structures [default = any]\n", pPars->nStructType );
     Abc_Print( -2, "\t-X num   : delay of AND-gate in LUT library units [default = %d]\n", pPars->nAndDelay );
     Abc_Print( -2, "\t-Y num   : area of AND-gate in LUT library units [default = %d]\n", pPars->nAndArea );
+    Abc_Print( -2, "\t-J num   : the number of threads used to compute cuts level by level;\n" );
+    Abc_Print( -2, "\t           0 = node-by-node order (the result may differ from J > 0) [default = %d]\n", pPars->nProcs );
     Abc_Print( -2, "\t-D float : sets the delay constraint for the mapping [default = %s]\n", Buffer );
     Abc_Print( -2, "\t-E float : sets epsilon used for tie-breaking [default = %f]\n", pPars->Epsilon );
     Abc_Print( -2, "\t-W float : sets wire delay between adjects LUTs [default = %f]\n", pPars->WireDelay );
@@ -36804,7 +37005,9 @@ int Abc_CommandAbc9If2( Abc_Frame_t * pAbc, int argc, char ** argv )
 {
     extern Abc_Ntk_t * Mpm_ManCellMapping( Gia_Man_t * p, Mpm_Par_t * pPars, void * pMio );
     extern Gia_Man_t * Mpm_ManLutMapping( Gia_Man_t * p, Mpm_Par_t * pPars );
+    extern Gia_Man_t * Mpm_ManLutMappingMig( char * pFileName, Mpm_Par_t * pPars );
     char Buffer[200];
+    char * pFileName = NULL;
     Abc_Ntk_t * pTemp;
     Gia_Man_t * pNew;
     Mpm_Par_t Pars, * pPars = &Pars;
@@ -36885,11 +37088,20 @@ int Abc_CommandAbc9If2( Abc_Frame_t * pAbc, int argc, char ** argv )
         }
     }
 
-    if ( pAbc->pGia == NULL )
+    if ( argc == globalUtilOptind + 1 )
+        pFileName = argv[globalUtilOptind];
+    else if ( argc != globalUtilOptind )
+        goto usage;
+    if ( pFileName == NULL && pAbc->pGia == NULL )
     {
         Abc_Print( -1, "Empty GIA network.\n" );
         return 1;
     }
+    if ( pFileName != NULL && pPars->fMap4Gates )
+    {
+        Abc_Print( -1, "Mapping MIG from file into standard cells is not supported.\n" );
+        return 1;
+    }
 
     if ( pPars->fMap4Cnf )
         pPars->fUseDsd = 1;
@@ -36935,7 +37147,10 @@ int Abc_CommandAbc9If2( Abc_Frame_t * pAbc, int argc, char ** argv )
     else
     {
         pPars->pLib = Mpm_LibLutSetSimple( nLutSize );
-        pNew = Mpm_ManLutMapping( pAbc->pGia, pPars );
+        if ( pFileName )
+            pNew = Mpm_ManLutMappingMig( pFileName, pPars );
+        else
+            pNew = Mpm_ManLutMapping( pAbc->pGia, pPars );
         Mpm_LibLutFree( pPars->pLib );
         if ( pNew == NULL )
         {
@@ -36951,7 +37166,7 @@ usage:
         sprintf(Buffer, "best possible" );
     else
         sprintf(Buffer, "%d", pPars->DelayTarget );
-    Abc_Print( -2, "usage: &if2 [-KCD num] [-tmzrcuxvwh]\n" );
+    Abc_Print( -2, "usage: &if2 [-KCD num] [-tmzrcuxvwh] <file>\n" );
     Abc_Print( -2, "\t           performs technology mapping of the network\n" );
     Abc_Print( -2, "\t-K num   : sets the LUT size for the mapping [default = %d]\n", nLutSize );
     Abc_Print( -2, "\t-C num   : the max number of priority cuts (0 < num < 2^12) [default = %d]\n", pPars->nNumCuts );
@@ -36966,6 +37181,7 @@ usage:
     Abc_Print( -2, "\t-v       : toggles verbose output [default = %s]\n", pPars->fVerbose? "yes": "no" );
     Abc_Print( -2, "\t-w       : toggles very verbose output [default = %s]\n", pPars->fVeryVerbose? "yes": "no" );
     Abc_Print( -2, "\t-h       : prints the command usage\n");
+    Abc_Print( -2, "\t<file>   : optional binary MIG file to be mapped instead of the current AIG\n");
     return 1;
 }
 
@@ -43728,7 +43944,7 @@ int Abc_CommandAbc9Mfs( Abc_Frame_t * pAbc, int argc, char ** argv )
     pPars->nDepthMax   =  100;
     pPars->nWinSizeMax = 2000;
     Extra_UtilGetoptReset();
-    while ( ( c = Extra_UtilGetopt( argc, argv, "WFDMLCNdaebvwh" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "WFDMLCNJdaebvwh" ) ) != EOF )
     {
         switch ( c )
         {
@@ -43809,6 +44025,17 @@ int Abc_CommandAbc9Mfs( Abc_Frame_t * pAbc, int argc, char ** argv )
             if ( pPars->nNodesMax < 0 )
                 goto usage;
             break;
+        case 'J':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-J\" should be followed by a positive integer.\n" );
+                goto usage;
+            }
+            pPars->nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( pPars->nProcs < 1 )
+                goto usage;
+            break;
         case 'd':
             pPars->fRrOnly ^= 1;
             break;
@@ -43863,7 +44090,7 @@ int Abc_CommandAbc9Mfs( Abc_Frame_t * pAbc, int argc, char ** argv )
     return 0;
 
 usage:
-    Abc_Print( -2, "usage: &mfs [-WFDMLCN <num>] [-daebvwh]\n" );
+    Abc_Print( -2, "usage: &mfs [-WFDMLCNJ <num>] [-daebvwh]\n" );
     Abc_Print( -2, "\t           performs don't-care-based optimization of logic networks\n" );
     Abc_Print( -2, "\t-W <num> : the number of levels in the TFO cone (0 <= num) [default = %d]\n",             pPars->nTfoLevMax );
     Abc_Print( -2, "\t-F <num> : the max number of fanouts to skip (1 <= num) [default = %d]\n",                pPars->nFanoutMax );
@@ -43872,6 +44099,7 @@ usage:
     Abc_Print( -2, "\t-L <num> : the max increase in node level after resynthesis (0 <= num) [default = %d]\n", pPars->nGrowthLevel );
     Abc_Print( -2, "\t-C <num> : the max number of conflicts in one SAT run (0 = no limit) [default = %d]\n",   pPars->nBTLimit );
     Abc_Print( -2, "\t-N <num> : the max number of nodes to try (0 = all) [default = %d]\n",                    pPars->nNodesMax );
+    Abc_Print( -2, "\t-J <num> : the number of threads used to evaluate windows [default = %d]\n",              pPars->nProcs );
     Abc_Print( -2, "\t-d       : toggle performing redundancy removal [default = %s]\n",                        pPars->fRrOnly? "yes": "no" );
     Abc_Print( -2, "\t-a       : toggle minimizing area or area+edges [default = %s]\n",                        pPars->fArea? "area": "area+edges" );
     Abc_Print( -2, "\t-e       : toggle high-effort resubstitution [default = %s]\n",                           pPars->fMoreEffort? "yes": "no" );
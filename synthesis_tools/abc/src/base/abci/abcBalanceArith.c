@@ -0,0 +1,859 @@
+/**CFile****************************************************************
+
+  FileName    [abcBalanceArith.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Network and node package.]
+
+  Synopsis    [Delay-oriented balancing of XOR/MUX/MAJ supergates and carry chains.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: abcBalanceArith.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "misc/vec/vecQue.h"
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define ABC_BAR_DEPTH    4      // the depth of the cone used to detect MAJ
+#define ABC_BAR_CUTS    16      // the max number of cuts per node in this cone
+#define ABC_BAR_CHAIN    3      // the min length of a carry chain to restructure
+#define ABC_BAR_GAIN     2      // the min reduction in depth to keep the restructured chains
+
+typedef struct Abc_BarMan_t_ Abc_BarMan_t;
+struct Abc_BarMan_t_
+{
+    Abc_Ntk_t *      pNtk;         // the old network
+    Abc_Ntk_t *      pNtkNew;      // the new network
+    Vec_Ptr_t *      vMaj;         // MAJ leaves of each node (3 entries per node ID)
+    Vec_Int_t *      vCarry;       // the index of the carry-in among the MAJ leaves
+    Vec_Int_t *      vSucc;        // the number of MAJ nodes using this one as carry-in
+    Vec_Int_t *      vChainTop;    // the top node of the chain this node belongs to
+    Vec_Int_t *      vPrefix;      // the top nodes of the chains to restructure as prefix (or NULL)
+    Vec_Flt_t *      vCosts;       // priorities of the supergate entries
+    Vec_Que_t *      vQue;         // priority queue of the supergate entries
+    Vec_Ptr_t *      vEntries;     // the supergate entries
+    // statistics
+    int              nMajs;
+    int              nMuxes;
+    int              nXors;
+    int              nChains;
+    int              nChainNodes;
+};
+
+static Abc_Obj_t * Abc_NodeBalanceArith_rec( Abc_BarMan_t * p, Abc_Obj_t * pNodeOld );
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Enumerates the cuts with at most 3 leaves in the limited-depth cone.]
+
+  Description [Each cut is stored as the number of leaves followed by
+  the sorted leaf IDs. Returns the number of cuts.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_NodeBarMergeCuts( int * pCut0, int * pCut1, int * pCut )
+{
+    int i = 1, k = 1, n = 0;
+    while ( i <= pCut0[0] || k <= pCut1[0] )
+    {
+        if ( n == 3 )
+            return 0;
+        if ( k > pCut1[0] || (i <= pCut0[0] && pCut0[i] < pCut1[k]) )
+            pCut[++n] = pCut0[i++];
+        else if ( i > pCut0[0] || pCut0[i] > pCut1[k] )
+            pCut[++n] = pCut1[k++];
+        else
+            pCut[++n] = pCut0[i++], k++;
+    }
+    pCut[0] = n;
+    return 1;
+}
+static int Abc_NodeBarCuts_rec( Abc_Obj_t * pObj, int Depth, int (*pCuts)[4] )
+{
+    int pCuts0[ABC_BAR_CUTS][4], pCuts1[ABC_BAR_CUTS][4];
+    int nCuts0, nCuts1, nCuts = 1, i, k, c;
+    pCuts[0][0] = 1;
+    pCuts[0][1] = Abc_ObjId(pObj);
+    if ( Depth == 0 || !Abc_AigNodeIsAnd(pObj) )
+        return 1;
+    nCuts0 = Abc_NodeBarCuts_rec( Abc_ObjFanin0(pObj), Depth-1, pCuts0 );
+    nCuts1 = Abc_NodeBarCuts_rec( Abc_ObjFanin1(pObj), Depth-1, pCuts1 );
+    for ( i = 0; i < nCuts0; i++ )
+    for ( k = 0; k < nCuts1; k++ )
+    {
+        if ( nCuts == ABC_BAR_CUTS )
+            return nCuts;
+        if ( !Abc_NodeBarMergeCuts( pCuts0[i], pCuts1[k], pCuts[nCuts] ) )
+            continue;
+        for ( c = 0; c < nCuts; c++ )
+            if ( !memcmp( pCuts[c], pCuts[nCuts], sizeof(int) * (pCuts[c][0] + 1) ) )
+                break;
+        if ( c == nCuts )
+            nCuts++;
+    }
+    return nCuts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the truth table of the node in terms of the cut.]
+
+  Description [Returns -1 if the cone is deeper than expected.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_NodeBarTruth_rec( Abc_Obj_t * pObj, int * pCut, int Depth )
+{
+    int i, Truth0, Truth1;
+    for ( i = 1; i <= pCut[0]; i++ )
+        if ( pCut[i] == (int)Abc_ObjId(pObj) )
+            return i == 1 ? 0xAA : (i == 2 ? 0xCC : 0xF0);
+    if ( Depth == 0 || !Abc_AigNodeIsAnd(pObj) )
+        return -1;
+    Truth0 = Abc_NodeBarTruth_rec( Abc_ObjFanin0(pObj), pCut, Depth-1 );
+    if ( Truth0 == -1 )
+        return -1;
+    Truth1 = Abc_NodeBarTruth_rec( Abc_ObjFanin1(pObj), pCut, Depth-1 );
+    if ( Truth1 == -1 )
+        return -1;
+    Truth0 = Abc_ObjFaninC0(pObj) ? ~Truth0 : Truth0;
+    Truth1 = Abc_ObjFaninC1(pObj) ? ~Truth1 : Truth1;
+    return Truth0 & Truth1 & 0xFF;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Detects the MAJ function rooted in the node.]
+
+  Description [If the node is MAJ(a, b, c) for some complemented or
+  uncomplemented nodes a, b, c, writes them into ppLeaves and returns 1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_NodeBarDetectMaj( Abc_Obj_t * pNode, Abc_Obj_t ** ppLeaves )
+{
+    Abc_Ntk_t * pNtk = pNode->pNtk;
+    int pCuts[ABC_BAR_CUTS][4];
+    int nCuts, Truth, Phase, A, B, C, i, k;
+    // the root of MAJ is an OR of two ANDs
+    if ( !Abc_ObjFaninC0(pNode) || !Abc_ObjFaninC1(pNode) )
+        return 0;
+    if ( !Abc_AigNodeIsAnd(Abc_ObjFanin0(pNode)) || !Abc_AigNodeIsAnd(Abc_ObjFanin1(pNode)) )
+        return 0;
+    if ( Abc_NodeIsMuxType(pNode) )
+        return 0;
+    nCuts = Abc_NodeBarCuts_rec( pNode, ABC_BAR_DEPTH, pCuts );
+    for ( i = 0; i < nCuts; i++ )
+    {
+        if ( pCuts[i][0] != 3 )
+            continue;
+        Truth = Abc_NodeBarTruth_rec( pNode, pCuts[i], ABC_BAR_DEPTH );
+        if ( Truth == -1 )
+            continue;
+        for ( Phase = 0; Phase < 8; Phase++ )
+        {
+            A = (Phase & 1) ? 0x55 : 0xAA;
+            B = (Phase & 2) ? 0x33 : 0xCC;
+            C = (Phase & 4) ? 0x0F : 0xF0;
+            if ( Truth != ((A & B) | (A & C) | (B & C)) )
+                continue;
+            for ( k = 0; k < 3; k++ )
+                ppLeaves[k] = Abc_ObjNotCond( Abc_NtkObj(pNtk, pCuts[i][k+1]), (Phase >> k) & 1 );
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Detects MAJ nodes and links them into carry chains.]
+
+  Description [A MAJ node is linked to the MAJ node driving its carry-in
+  if it is the only MAJ node using that one as carry-in. The carry-in is
+  the latest-arriving MAJ leaf among the three leaves.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_NtkBarDetectChains( Abc_BarMan_t * p )
+{
+    Abc_Obj_t * pNode, * pLeaf, * pLeaves[3];
+    int i, k, iCarry, iTop, iCur;
+    Vec_PtrFill( p->vMaj, 3 * Abc_NtkObjNumMax(p->pNtk), NULL );
+    Vec_IntFill( p->vCarry, Abc_NtkObjNumMax(p->pNtk), -1 );
+    Vec_IntFill( p->vSucc, Abc_NtkObjNumMax(p->pNtk), 0 );
+    Vec_IntFill( p->vChainTop, Abc_NtkObjNumMax(p->pNtk), -1 );
+    // detect MAJ nodes
+    Abc_NtkForEachNode( p->pNtk, pNode, i )
+    {
+        if ( !Abc_NodeBarDetectMaj( pNode, pLeaves ) )
+            continue;
+        for ( k = 0; k < 3; k++ )
+            Vec_PtrWriteEntry( p->vMaj, 3*i+k, pLeaves[k] );
+        p->nMajs++;
+    }
+    // find the carry-in of each MAJ node
+    Abc_NtkForEachNode( p->pNtk, pNode, i )
+    {
+        if ( Vec_PtrEntry(p->vMaj, 3*i) == NULL )
+            continue;
+        iCarry = -1;
+        for ( k = 0; k < 3; k++ )
+        {
+            pLeaf = Abc_ObjRegular( (Abc_Obj_t *)Vec_PtrEntry(p->vMaj, 3*i+k) );
+            if ( Vec_PtrEntry(p->vMaj, 3*Abc_ObjId(pLeaf)) == NULL )
+                continue;
+            if ( iCarry == -1 || Abc_ObjRegular((Abc_Obj_t *)Vec_PtrEntry(p->vMaj, 3*i+iCarry))->Level < pLeaf->Level )
+                iCarry = k;
+        }
+        if ( iCarry == -1 )
+            continue;
+        Vec_IntWriteEntry( p->vCarry, i, iCarry );
+        pLeaf = Abc_ObjRegular( (Abc_Obj_t *)Vec_PtrEntry(p->vMaj, 3*i+iCarry) );
+        Vec_IntAddToEntry( p->vSucc, Abc_ObjId(pLeaf), 1 );
+    }
+    // a MAJ node with a linked carry-in cannot be the carry-in of two nodes
+    Abc_NtkForEachNode( p->pNtk, pNode, i )
+    {
+        iCarry = Vec_IntEntry( p->vCarry, i );
+        if ( iCarry == -1 )
+            continue;
+        pLeaf = Abc_ObjRegular( (Abc_Obj_t *)Vec_PtrEntry(p->vMaj, 3*i+iCarry) );
+        if ( Vec_IntEntry(p->vSucc, Abc_ObjId(pLeaf)) != 1 )
+            Vec_IntWriteEntry( p->vCarry, i, -1 );
+    }
+    // assign the chains to their top nodes
+    Abc_NtkForEachNode( p->pNtk, pNode, i )
+    {
+        if ( Vec_PtrEntry(p->vMaj, 3*i) == NULL || Vec_IntEntry(p->vSucc, i) == 1 )
+            continue;
+        // this is the top node; count the chain length
+        iTop = iCur = i;
+        for ( k = 1; Vec_IntEntry(p->vCarry, iCur) != -1; k++ )
+            iCur = Abc_ObjId( Abc_ObjRegular((Abc_Obj_t *)Vec_PtrEntry(p->vMaj, 3*iCur+Vec_IntEntry(p->vCarry, iCur))) );
+        if ( k < ABC_BAR_CHAIN )
+            continue;
+        p->nChains++;
+        p->nChainNodes += k;
+        for ( iCur = iTop; ; )
+        {
+            Vec_IntWriteEntry( p->vChainTop, iCur, iTop );
+            if ( Vec_IntEntry(p->vCarry, iCur) == -1 )
+                break;
+            iCur = Abc_ObjId( Abc_ObjRegular((Abc_Obj_t *)Vec_PtrEntry(p->vMaj, 3*iCur+Vec_IntEntry(p->vCarry, iCur))) );
+        }
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Combines the supergate entries in the order of their levels.]
+
+  Description [The two entries with the smallest levels are combined
+  first, using the priority queue, which makes the tree arrival-time
+  aware and the runtime O(n log n) in the supergate size.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Abc_Obj_t * Abc_NodeBarXor( Abc_Aig_t * pMan, Abc_Obj_t * p0, Abc_Obj_t * p1 )
+{
+    return Abc_AigAnd( pMan, Abc_AigOr(pMan, p0, p1), Abc_ObjNot(Abc_AigAnd(pMan, p0, p1)) );
+}
+static Abc_Obj_t * Abc_NodeBarBuildTree( Abc_BarMan_t * p, int fXor )
+{
+    Abc_Aig_t * pMan = (Abc_Aig_t *)p->pNtkNew->pManFunc;
+    Abc_Obj_t * pObj, * pObj0, * pObj1;
+    int i, iEntry0, iEntry1;
+    assert( Vec_PtrSize(p->vEntries) > 0 );
+    Vec_FltClear( p->vCosts );
+    Vec_QueClear( p->vQue );
+    Vec_PtrForEachEntry( Abc_Obj_t *, p->vEntries, pObj, i )
+    {
+        Vec_FltPush( p->vCosts, -(float)Abc_ObjRegular(pObj)->Level );
+        Vec_QuePush( p->vQue, i );
+    }
+    while ( Vec_QueSize(p->vQue) > 1 )
+    {
+        iEntry0 = Vec_QuePop( p->vQue );
+        iEntry1 = Vec_QuePop( p->vQue );
+        pObj0   = (Abc_Obj_t *)Vec_PtrEntry( p->vEntries, iEntry0 );
+        pObj1   = (Abc_Obj_t *)Vec_PtrEntry( p->vEntries, iEntry1 );
+        pObj    = fXor ? Abc_NodeBarXor( pMan, pObj0, pObj1 ) : Abc_AigAnd( pMan, pObj0, pObj1 );
+        Vec_PtrPush( p->vEntries, pObj );
+        Vec_FltPush( p->vCosts, -(float)Abc_ObjRegular(pObj)->Level );
+        Vec_QuePush( p->vQue, Vec_PtrSize(p->vEntries) - 1 );
+    }
+    pObj = (Abc_Obj_t *)Vec_PtrEntry( p->vEntries, Vec_QuePop(p->vQue) );
+    Vec_PtrClear( p->vEntries );
+    return pObj;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the node is the root of a special supergate.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_NodeBarIsSpecial( Abc_BarMan_t * p, Abc_Obj_t * pNode )
+{
+    return Vec_PtrEntry(p->vMaj, 3*Abc_ObjId(pNode)) != NULL || Abc_NodeIsMuxType(pNode);
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Orders the nodes by their IDs.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_NodeBarCompareIds( Abc_Obj_t ** pp1, Abc_Obj_t ** pp2 )
+{
+    int Diff = (int)Abc_ObjId(*pp1) - (int)Abc_ObjId(*pp2);
+    if ( Diff < 0 )
+        return -1;
+    if ( Diff > 0 ) 
+        return 1;
+    return 0; 
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the leaves of the XOR supergate.]
+
+  Description [Returns the parity of the complemented attributes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_NodeBarCollectXor_rec( Abc_BarMan_t * p, Abc_Obj_t * pNode, Vec_Ptr_t * vSuper, int fFirst )
+{
+    Abc_Obj_t * pNodeC, * pNodeT, * pNodeE;
+    int fCompl = Abc_ObjIsComplement(pNode);
+    pNode = Abc_ObjRegular(pNode);
+    if ( !fFirst && (!Abc_AigNodeIsAnd(pNode) || !Abc_NodeIsExorType(pNode) || Abc_ObjFanoutNum(pNode) > 1 || Vec_PtrSize(vSuper) > 10000) )
+    {
+        Vec_PtrPush( vSuper, pNode );
+        return fCompl;
+    }
+    p->nXors++;
+    pNodeC = Abc_NodeRecognizeMux( pNode, &pNodeT, &pNodeE );
+    assert( Abc_ObjRegular(pNodeT) == Abc_ObjRegular(pNodeE) );
+    fCompl ^= Abc_NodeBarCollectXor_rec( p, pNodeC, vSuper, 0 );
+    fCompl ^= Abc_NodeBarCollectXor_rec( p, pNodeE, vSuper, 0 );
+    return fCompl;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the leaves of the AND supergate.]
+
+  Description [Returns -1 if the supergate has the same node in both
+  polarities.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_NodeBarCollectAnd_rec( Abc_BarMan_t * p, Abc_Obj_t * pNode, Vec_Ptr_t * vSuper, int fFirst )
+{
+    Abc_Obj_t * pObj;
+    int i;
+    if ( !fFirst && (Abc_ObjIsComplement(pNode) || !Abc_AigNodeIsAnd(pNode) || Abc_ObjFanoutNum(pNode) > 1 ||
+                     Abc_NodeBarIsSpecial(p, pNode) || Vec_PtrSize(vSuper) > 10000) )
+    {
+        Vec_PtrForEachEntry( Abc_Obj_t *, vSuper, pObj, i )
+        {
+            if ( pObj == pNode )
+                return 0;
+            if ( pObj == Abc_ObjNot(pNode) )
+                return -1;
+        }
+        Vec_PtrPush( vSuper, pNode );
+        return 0;
+    }
+    if ( Abc_NodeBarCollectAnd_rec( p, Abc_ObjChild0(pNode), vSuper, 0 ) == -1 )
+        return -1;
+    return Abc_NodeBarCollectAnd_rec( p, Abc_ObjChild1(pNode), vSuper, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the balanced copy of the leaf.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline Abc_Obj_t * Abc_NodeBarCopy( Abc_BarMan_t * p, Abc_Obj_t * pLeaf )
+{
+    return Abc_ObjNotCond( Abc_NodeBalanceArith_rec(p, Abc_ObjRegular(pLeaf)), Abc_ObjIsComplement(pLeaf) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Restructures the carry chain as a parallel prefix.]
+
+  Description [The chain is c[i] = MAJ(a[i], b[i], c[i-1]), i = 1..k.
+  Using g[i] = a[i] & b[i] and p[i] = a[i] | b[i], we have c[i] = g[i] |
+  p[i] & c[i-1], which is the prefix of the (g, p) pairs under the
+  associative operator (g, p) o (g', p') = (g | p & g', p & p'), with
+  c[0] as the (g, 0) pair at position 0. The prefix is computed by the
+  Sklansky scheme in log2(k) levels of the operator. Each carry is then
+  taken from the ripple or from the prefix, whichever arrives earlier,
+  so that the chains with staggered side inputs (as in array multipliers)
+  remain ripple; the unused nodes are removed by the final cleanup. The
+  complemented carry-in edges are handled by propagating the phase up
+  the chain, using the self-duality of MAJ.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_NodeBarPrefix_rec( Abc_Aig_t * pMan, Abc_Obj_t ** pG, Abc_Obj_t ** pP, int iLo, int iHi )
+{
+    int i, iMid = (iLo + iHi) / 2;
+    if ( iLo >= iHi )
+        return;
+    Abc_NodeBarPrefix_rec( pMan, pG, pP, iLo, iMid );
+    Abc_NodeBarPrefix_rec( pMan, pG, pP, iMid + 1, iHi );
+    for ( i = iMid + 1; i <= iHi; i++ )
+    {
+        pG[i] = Abc_AigOr( pMan, pG[i], Abc_AigAnd(pMan, pP[i], pG[iMid]) );
+        pP[i] = Abc_AigAnd( pMan, pP[i], pP[iMid] );
+    }
+}
+static void Abc_NodeBarBuildChain( Abc_BarMan_t * p, Abc_Obj_t * pTop )
+{
+    Abc_Aig_t * pMan = (Abc_Aig_t *)p->pNtkNew->pManFunc;
+    Vec_Ptr_t * vChain = Vec_PtrAlloc( 100 );
+    Vec_Int_t * vPhase = Vec_IntAlloc( 100 );
+    Abc_Obj_t ** pG, ** pP, ** pG0, ** pP0, * pNode, * pCarry, * pA, * pB;
+    int i, k, iCarry, Phase, nNodes, fReentered = 0;
+    // collect the chain from the top to the bottom
+    for ( pNode = pTop; ; pNode = Abc_ObjRegular(pCarry) )
+    {
+        Vec_PtrPush( vChain, pNode );
+        iCarry = Vec_IntEntry( p->vCarry, Abc_ObjId(pNode) );
+        if ( iCarry == -1 )
+        {
+            // the bottom node: choose the latest-arriving leaf as the carry-in
+            iCarry = 0;
+            for ( k = 1; k < 3; k++ )
+                if ( Abc_ObjRegular((Abc_Obj_t *)Vec_PtrEntry(p->vMaj, 3*Abc_ObjId(pNode)+k))->Level >
+                     Abc_ObjRegular((Abc_Obj_t *)Vec_PtrEntry(p->vMaj, 3*Abc_ObjId(pNode)+iCarry))->Level )
+                    iCarry = k;
+            Vec_IntWriteEntry( p->vCarry, Abc_ObjId(pNode), iCarry );
+            break;
+        }
+        pCarry = (Abc_Obj_t *)Vec_PtrEntry( p->vMaj, 3*Abc_ObjId(pNode)+iCarry );
+    }
+    Vec_PtrReverseOrder( vChain );
+    nNodes = Vec_PtrSize( vChain );
+    // dissolve the chain, in case the side inputs depend on its nodes
+    Vec_PtrForEachEntry( Abc_Obj_t *, vChain, pNode, i )
+        Vec_IntWriteEntry( p->vChainTop, Abc_ObjId(pNode), -1 );
+    // create the (g, p) pairs; position 0 is the carry-in of the chain
+    pG  = ABC_ALLOC( Abc_Obj_t *, nNodes + 1 );
+    pP  = ABC_ALLOC( Abc_Obj_t *, nNodes + 1 );
+    pG0 = ABC_ALLOC( Abc_Obj_t *, nNodes + 1 );
+    pP0 = ABC_ALLOC( Abc_Obj_t *, nNodes + 1 );
+    Phase = 0;
+    Vec_PtrForEachEntry( Abc_Obj_t *, vChain, pNode, i )
+    {
+        iCarry = Vec_IntEntry( p->vCarry, Abc_ObjId(pNode) );
+        pCarry = (Abc_Obj_t *)Vec_PtrEntry( p->vMaj, 3*Abc_ObjId(pNode)+iCarry );
+        if ( i == 0 )
+        {
+            pG[0] = Abc_NodeBarCopy( p, pCarry );
+            pP[0] = Abc_ObjNot( Abc_AigConst1(p->pNtkNew) );
+        }
+        else
+            Phase ^= Abc_ObjIsComplement( pCarry );
+        Vec_IntPush( vPhase, Phase );
+        pA = (Abc_Obj_t *)Vec_PtrEntry( p->vMaj, 3*Abc_ObjId(pNode)+(iCarry+1)%3 );
+        pB = (Abc_Obj_t *)Vec_PtrEntry( p->vMaj, 3*Abc_ObjId(pNode)+(iCarry+2)%3 );
+        pA = Abc_ObjNotCond( Abc_NodeBarCopy(p, pA), Phase );
+        pB = Abc_ObjNotCond( Abc_NodeBarCopy(p, pB), Phase );
+        pG[i+1] = Abc_AigAnd( pMan, pA, pB );
+        pP[i+1] = Abc_NodeBarXor( pMan, pA, pB );
+    }
+    Vec_PtrForEachEntry( Abc_Obj_t *, vChain, pNode, i )
+        fReentered |= (pNode->pCopy != NULL);
+    if ( fReentered )
+    {
+        // some nodes of the chain were derived as standalone MAJs
+        Vec_PtrForEachEntry( Abc_Obj_t *, vChain, pNode, i )
+            Abc_NodeBalanceArith_rec( p, pNode );
+    }
+    else if ( p->vPrefix == NULL || !Vec_IntEntry(p->vPrefix, Abc_ObjId(pTop)) )
+    {
+        // keep the ripple
+        pCarry = pG[0];
+        Vec_PtrForEachEntry( Abc_Obj_t *, vChain, pNode, i )
+        {
+            pCarry = Abc_AigOr( pMan, pG[i+1], Abc_AigAnd(pMan, pP[i+1], pCarry) );
+            pNode->pCopy = Abc_ObjNotCond( pCarry, Vec_IntEntry(vPhase, i) );
+        }
+    }
+    else
+    {
+        // compute the prefix
+        memcpy( pG0, pG, sizeof(Abc_Obj_t *) * (nNodes + 1) );
+        memcpy( pP0, pP, sizeof(Abc_Obj_t *) * (nNodes + 1) );
+        Abc_NodeBarPrefix_rec( pMan, pG, pP, 0, nNodes );
+        // for each carry, use the ripple or the prefix, whichever arrives earlier
+        pCarry = pG[0];
+        Vec_PtrForEachEntry( Abc_Obj_t *, vChain, pNode, i )
+        {
+            pA = Abc_AigOr( pMan, pG0[i+1], Abc_AigAnd(pMan, pP0[i+1], pCarry) );
+            pCarry = Abc_ObjRegular(pA)->Level <= Abc_ObjRegular(pG[i+1])->Level ? pA : pG[i+1];
+            pNode->pCopy = Abc_ObjNotCond( pCarry, Vec_IntEntry(vPhase, i) );
+        }
+    }
+    ABC_FREE( pG );
+    ABC_FREE( pP );
+    ABC_FREE( pG0 );
+    ABC_FREE( pP0 );
+    Vec_IntFree( vPhase );
+    Vec_PtrFree( vChain );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Rebalances the supergate rooted at pNodeOld.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Obj_t * Abc_NodeBalanceArith_rec( Abc_BarMan_t * p, Abc_Obj_t * pNodeOld )
+{
+    Abc_Aig_t * pMan = (Abc_Aig_t *)p->pNtkNew->pManFunc;
+    Abc_Obj_t * pNodeC, * pNodeT, * pNodeE, * pObj, * pLeaves[3];
+    Vec_Ptr_t * vSuper;
+    int i, k, iTop, fCompl;
+    assert( !Abc_ObjIsComplement(pNodeOld) );
+    // return if the result if known
+    if ( pNodeOld->pCopy )
+        return pNodeOld->pCopy;
+    assert( Abc_ObjIsNode(pNodeOld) );
+    // carry chain
+    iTop = Vec_IntEntry( p->vChainTop, Abc_ObjId(pNodeOld) );
+    if ( iTop >= 0 )
+    {
+        Abc_NodeBarBuildChain( p, Abc_NtkObj(p->pNtk, iTop) );
+        assert( pNodeOld->pCopy != NULL );
+        return pNodeOld->pCopy;
+    }
+    // standalone MAJ: the latest-arriving input goes last
+    if ( Vec_PtrEntry(p->vMaj, 3*Abc_ObjId(pNodeOld)) != NULL )
+    {
+        for ( k = 0; k < 3; k++ )
+            pLeaves[k] = Abc_NodeBarCopy( p, (Abc_Obj_t *)Vec_PtrEntry(p->vMaj, 3*Abc_ObjId(pNodeOld)+k) );
+        for ( k = 0; k < 2; k++ )
+            if ( Abc_ObjRegular(pLeaves[k])->Level > Abc_ObjRegular(pLeaves[2])->Level )
+                ABC_SWAP( Abc_Obj_t *, pLeaves[k], pLeaves[2] );
+        pObj = Abc_AigAnd( pMan, pLeaves[2], Abc_AigOr(pMan, pLeaves[0], pLeaves[1]) );
+        pNodeOld->pCopy = Abc_AigOr( pMan, Abc_AigAnd(pMan, pLeaves[0], pLeaves[1]), pObj );
+        return pNodeOld->pCopy;
+    }
+    vSuper = Vec_PtrAlloc( 16 );
+    // XOR supergate
+    if ( Abc_NodeIsExorType(pNodeOld) )
+    {
+        fCompl = Abc_NodeBarCollectXor_rec( p, pNodeOld, vSuper, 1 );
+        // remove the pairs of identical leaves
+        Vec_PtrSort( vSuper, (int (*)(void))Abc_NodeBarCompareIds );
+        for ( i = k = 0; i < Vec_PtrSize(vSuper); i++ )
+            if ( i + 1 < Vec_PtrSize(vSuper) && Vec_PtrEntry(vSuper, i) == Vec_PtrEntry(vSuper, i+1) )
+                i++;
+            else
+                Vec_PtrWriteEntry( vSuper, k++, Vec_PtrEntry(vSuper, i) );
+        Vec_PtrShrink( vSuper, k );
+        Vec_PtrForEachEntry( Abc_Obj_t *, vSuper, pObj, i )
+            Vec_PtrWriteEntry( vSuper, i, Abc_NodeBalanceArith_rec(p, pObj) );
+        // the entries are added after all leaves are derived, because deriving them uses p->vEntries
+        Vec_PtrForEachEntry( Abc_Obj_t *, vSuper, pObj, i )
+            Vec_PtrPush( p->vEntries, pObj );
+        if ( Vec_PtrSize(p->vEntries) == 0 )
+            pObj = Abc_ObjNot( Abc_AigConst1(p->pNtkNew) );
+        else
+            pObj = Abc_NodeBarBuildTree( p, 1 );
+        pNodeOld->pCopy = Abc_ObjNotCond( pObj, fCompl );
+        Vec_PtrFree( vSuper );
+        return pNodeOld->pCopy;
+    }
+    // MUX
+    if ( Abc_NodeIsMuxType(pNodeOld) )
+    {
+        p->nMuxes++;
+        pNodeC = Abc_NodeRecognizeMux( pNodeOld, &pNodeT, &pNodeE );
+        pNodeC = Abc_NodeBarCopy( p, pNodeC );
+        pNodeT = Abc_NodeBarCopy( p, pNodeT );
+        pNodeE = Abc_NodeBarCopy( p, pNodeE );
+        pNodeOld->pCopy = Abc_AigMux( pMan, pNodeC, pNodeT, pNodeE );
+        Vec_PtrFree( vSuper );
+        return pNodeOld->pCopy;
+    }
+    // AND supergate
+    if ( Abc_NodeBarCollectAnd_rec( p, pNodeOld, vSuper, 1 ) == -1 )
+        pNodeOld->pCopy = Abc_ObjNot( Abc_AigConst1(p->pNtkNew) );
+    else
+    {
+        Vec_PtrForEachEntry( Abc_Obj_t *, vSuper, pObj, i )
+            Vec_PtrWriteEntry( vSuper, i, Abc_NodeBarCopy(p, pObj) );
+        Vec_PtrForEachEntry( Abc_Obj_t *, vSuper, pObj, i )
+            Vec_PtrPush( p->vEntries, pObj );
+        pNodeOld->pCopy = Abc_NodeBarBuildTree( p, 0 );
+    }
+    Vec_PtrFree( vSuper );
+    return pNodeOld->pCopy;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the balanced network.]
+
+  Description [The carry chains whose top nodes are marked in vPrefix 
+  are restructured as parallel prefix; other chains remain ripple. If 
+  vTops is given, it returns the top node of the chain of each node. 
+  The pCopy fields of the old nodes point to the new nodes, which are
+  not cleaned up.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Ntk_t * Abc_NtkBalanceArithInt( Abc_Ntk_t * pNtk, Vec_Int_t * vPrefix, Vec_Int_t * vTops, int fVerbose )
+{
+    Abc_BarMan_t * p;
+    Abc_Ntk_t * pNtkAig;
+    Abc_Obj_t * pNode;
+    abctime clk = Abc_Clock();
+    int i;
+    Abc_NtkCleanCopy( pNtk );
+    pNtkAig = Abc_NtkStartFrom( pNtk, ABC_NTK_STRASH, ABC_FUNC_AIG );
+    // transfer level
+    Abc_NtkForEachCi( pNtk, pNode, i )
+        pNode->pCopy->Level = pNode->Level;
+    // start the manager
+    p = ABC_CALLOC( Abc_BarMan_t, 1 );
+    p->pNtk      = pNtk;
+    p->pNtkNew   = pNtkAig;
+    p->vPrefix   = vPrefix;
+    p->vMaj      = Vec_PtrAlloc( 0 );
+    p->vCarry    = Vec_IntAlloc( 0 );
+    p->vSucc     = Vec_IntAlloc( 0 );
+    p->vChainTop = Vec_IntAlloc( 0 );
+    p->vCosts    = Vec_FltAlloc( 100 );
+    p->vQue      = Vec_QueAlloc( 100 );
+    p->vEntries  = Vec_PtrAlloc( 100 );
+    Vec_QueSetPriority( p->vQue, Vec_FltArrayP(p->vCosts) );
+    Abc_NtkBarDetectChains( p );
+    if ( vTops )
+    {
+        Vec_IntClear( vTops );
+        Vec_IntAppend( vTops, p->vChainTop );
+    }
+    // balance the logic cones of the COs
+    Abc_NtkForEachCo( pNtk, pNode, i )
+        Abc_NodeBalanceArith_rec( p, Abc_ObjFanin0(pNode) );
+    if ( fVerbose )
+    {
+        printf( "MAJ = %d.  Chains = %d. (Nodes = %d.)  MUX = %d.  XOR = %d.  ",
+            p->nMajs, p->nChains, p->nChainNodes, p->nMuxes, p->nXors );
+        ABC_PRT( "Time", Abc_Clock() - clk );
+    }
+    Vec_PtrFree( p->vMaj );
+    Vec_IntFree( p->vCarry );
+    Vec_IntFree( p->vSucc );
+    Vec_IntFree( p->vChainTop );
+    Vec_FltFree( p->vCosts );
+    Vec_QueFree( p->vQue );
+    Vec_PtrFree( p->vEntries );
+    ABC_FREE( p );
+    // finalize the network
+    Abc_NtkFinalize( pNtk, pNtkAig );
+    return pNtkAig;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Marks the carry chains that are on the critical path.]
+
+  Description [Returns the number of marked chains.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Abc_NtkBalanceArithMarkCritical( Abc_Ntk_t * pNtk, Abc_Ntk_t * pNtkAig, Vec_Int_t * vTops, Vec_Int_t * vPrefix )
+{
+    Abc_Obj_t * pNode, * pCopy;
+    int i, iTop, Path, PathMax = 0, nMarked = 0;
+    Abc_NtkStartReverseLevels( pNtkAig, 0 );
+    Abc_NtkForEachNode( pNtkAig, pNode, i )
+        PathMax = Abc_MaxInt( PathMax, (int)pNode->Level + Abc_ObjReverseLevel(pNode) );
+    Vec_IntFill( vPrefix, Abc_NtkObjNumMax(pNtk), 0 );
+    Abc_NtkForEachNode( pNtk, pNode, i )
+    {
+        iTop = Vec_IntEntry( vTops, i );
+        if ( iTop == -1 || Vec_IntEntry(vPrefix, iTop) )
+            continue;
+        pCopy = Abc_ObjRegular( pNode->pCopy );
+        if ( !Abc_ObjIsNode(pCopy) )
+            continue;
+        Path = (int)pCopy->Level + Abc_ObjReverseLevel( pCopy );
+        if ( Path < PathMax )
+            continue;
+        Vec_IntWriteEntry( vPrefix, iTop, 1 );
+        nMarked++;
+    }
+    Abc_NtkStopReverseLevels( pNtkAig );
+    return nMarked;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Balances the AIG with XOR, MUX, and MAJ supergates.]
+
+  Description [Detects XOR, MUX and MAJ supergates as well as the carry
+  chains composed of MAJ nodes. The AND and XOR supergates are rebuilt
+  as trees, combining the earliest-arriving entries first. Other nodes
+  are rebuilt as they are, with their fanins balanced recursively. 
+  The network is first derived with the carry chains kept ripple. 
+  Then the chains on the critical path are restructured as parallel 
+  prefix, which is kept only if the depth is reduced by more than 
+  ABC_BAR_GAIN levels, because the prefix costs area. Finally, the 
+  result is compared with the one of Abc_NtkBalance() called with the 
+  same parameters, and the better one is returned (smaller depth first, 
+  then fewer nodes), so that this command never loses to "balance".]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Ntk_t * Abc_NtkBalanceArith( Abc_Ntk_t * pNtk, int fDuplicate, int fSelective, int fUpdateLevel, int fVerbose )
+{
+    Abc_Ntk_t * pNtkAig, * pNtkPre, * pNtkBal;
+    Vec_Int_t * vTops, * vPrefix;
+    int nMarked, LevelAig, LevelPre, LevelBal;
+    assert( Abc_NtkIsStrash(pNtk) );
+    if ( pNtk->nBarBufs > 0 )
+    {
+        printf( "Abc_NtkBalanceArith: Barrier buffers are not supported.\n" );
+        return NULL;
+    }
+    // set the level of PIs of AIG according to the arrival times of the old network
+    Abc_NtkSetNodeLevelsArrival( pNtk );
+    // derive the network with the ripple carry chains
+    vTops   = Vec_IntAlloc( 0 );
+    vPrefix = Vec_IntAlloc( 0 );
+    pNtkAig = Abc_NtkBalanceArithInt( pNtk, NULL, vTops, fVerbose );
+    // restructure the chains on the critical path
+    nMarked = Abc_NtkBalanceArithMarkCritical( pNtk, pNtkAig, vTops, vPrefix );
+    Abc_AigCleanup( (Abc_Aig_t *)pNtkAig->pManFunc );
+    if ( nMarked > 0 )
+    {
+        pNtkPre = Abc_NtkBalanceArithInt( pNtk, vPrefix, NULL, 0 );
+        Abc_AigCleanup( (Abc_Aig_t *)pNtkPre->pManFunc );
+        LevelAig = Abc_NtkLevel( pNtkAig );
+        LevelPre = Abc_NtkLevel( pNtkPre );
+        if ( fVerbose )
+            printf( "Prefix chains = %d.  Ripple: Nodes = %d. Levels = %d.  Prefix: Nodes = %d. Levels = %d.\n", 
+                nMarked, Abc_NtkNodeNum(pNtkAig), LevelAig, Abc_NtkNodeNum(pNtkPre), LevelPre );
+        if ( LevelAig - LevelPre > ABC_BAR_GAIN )
+            ABC_SWAP( Abc_Ntk_t *, pNtkAig, pNtkPre );
+        Abc_NtkDelete( pNtkPre );
+    }
+    Vec_IntFree( vTops );
+    Vec_IntFree( vPrefix );
+    // compare with the conventional balancing
+    pNtkBal = Abc_NtkBalance( pNtk, fDuplicate, fSelective, fUpdateLevel );
+    if ( pNtkBal != NULL )
+    {
+        LevelAig = Abc_NtkLevel( pNtkAig );
+        LevelBal = Abc_NtkLevel( pNtkBal );
+        if ( fVerbose )
+            printf( "Arithmetic: Nodes = %d. Levels = %d.  Conventional: Nodes = %d. Levels = %d.\n", 
+                Abc_NtkNodeNum(pNtkAig), LevelAig, Abc_NtkNodeNum(pNtkBal), LevelBal );
+        if ( LevelBal < LevelAig || (LevelBal == LevelAig && Abc_NtkNodeNum(pNtkBal) <= Abc_NtkNodeNum(pNtkAig)) )
+        {
+            Abc_NtkDelete( pNtkAig );
+            return pNtkBal;
+        }
+        Abc_NtkDelete( pNtkBal );
+    }
+    if ( pNtk->pExdc )
+        pNtkAig->pExdc = Abc_NtkDup( pNtk->pExdc );
+    // make sure everything is okay
+    if ( !Abc_NtkCheck( pNtkAig ) )
+    {
+        printf( "Abc_NtkBalanceArith: The network check has failed.\n" );
+        Abc_NtkDelete( pNtkAig );
+        return NULL;
+    }
+    return pNtkAig;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
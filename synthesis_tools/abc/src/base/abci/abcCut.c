@@ -529,6 +529,86 @@ void Abc_NodeFreeCuts( void * p, Abc_Obj_t * pObj )
     Cut_NodeFreeCuts( (Cut_Man_t *)p, pObj->Id );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Transfers the cuts to the new object IDs.]
+
+  Description [Should be called after the objects are assigned new IDs
+  but before the array of objects (which is in the old order) is replaced.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkRemapCuts( void * p, Abc_Ntk_t * pNtk )
+{
+    Vec_Int_t * vMap;
+    Abc_Obj_t * pObj;
+    int i;
+    vMap = Vec_IntStartFull( Vec_PtrSize(pNtk->vObjs) );
+    Abc_NtkForEachObj( pNtk, pObj, i )
+        Vec_IntWriteEntry( vMap, i, pObj->Id );
+    Cut_ManRemapIds( (Cut_Man_t *)p, vMap );
+    Vec_IntFree( vMap );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Updates the cuts saved from the previous computation.]
+
+  Description [Assumes that the nodes are in a topological order and that
+  the cut manager records the fanins of the nodes. The nodes without cuts 
+  (such as those deleted and recreated by the AIG package) and the nodes 
+  whose fanins have changed get their cuts recomputed. The change is 
+  propagated to the fanouts only if the recomputed cuts differ from the 
+  old ones. Returns the number of nodes whose cuts were reused without 
+  recomputation.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkUpdateCuts( void * p, Abc_Ntk_t * pNtk )
+{
+    Cut_Cut_t * pListOld, * pListNew;
+    Abc_Obj_t * pObj, * pFanout;
+    int i, k, Counter = 0;
+    assert( Abc_NtkIsStrash(pNtk) );
+    // set the cuts for the new PIs
+    Abc_NtkForEachCi( pNtk, pObj, i )
+        if ( Abc_ObjFanoutNum(pObj) > 0 && Abc_NodeReadCuts(p, pObj) == NULL )
+            Cut_NodeSetTriv( (Cut_Man_t *)p, pObj->Id );
+    // recompute the cuts of the changed nodes
+    Abc_NtkForEachNode( pNtk, pObj, i )
+    {
+        pListOld = (Cut_Cut_t *)Abc_NodeReadCuts( p, pObj );
+        if ( pListOld != NULL && !pObj->fMarkA && Cut_NodeCheckFanins( (Cut_Man_t *)p, pObj->Id,
+                Abc_ObjFaninId0(pObj), Abc_ObjFaninId1(pObj), Abc_ObjFaninC0(pObj), Abc_ObjFaninC1(pObj) ) )
+        {
+            Counter++;
+            continue;
+        }
+        pObj->fMarkA = 0;
+        if ( pListOld != NULL )
+            Cut_NodeWriteCutsNew( (Cut_Man_t *)p, pObj->Id, NULL );
+        pListNew = (Cut_Cut_t *)Abc_NodeGetCutsRecursive( p, pObj, 0, 0 );
+        if ( pListOld != NULL && Cut_CutListEqual(pListOld, pListNew) )
+        {
+            Cut_CutRecycleList( (Cut_Man_t *)p, pListOld );
+            continue;
+        }
+        if ( pListOld != NULL )
+            Cut_CutRecycleList( (Cut_Man_t *)p, pListOld );
+        Abc_ObjForEachFanout( pObj, pFanout, k )
+            pFanout->fMarkA = 1;
+    }
+    Abc_NtkForEachCo( pNtk, pObj, i )
+        pObj->fMarkA = 0;
+    return Counter;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the cuts for the network.]
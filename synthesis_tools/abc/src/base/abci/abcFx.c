@@ -21,9 +21,20 @@
 #include "base/abc/abc.h"
 #include "misc/vec/vecWec.h"
 #include "misc/vec/vecQue.h"
-#include "misc/vec/vecHsh.h"
+#include "misc/util/utilTruth.h"
 #include "opt/fxch/Fxch.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -76,13 +87,30 @@ ABC_NAMESPACE_IMPL_START
     It may be convenient to think about the first (second) array as rows (columns) of a sparse matrix, 
     although the sparse matrix data-structure is not used in the proposed implementation.
     (3) Hash table (pMan->pHash) hashes the normalized divisors (represented as integer arrays) into integer numbers.
+    It uses open addressing with linear probing in a flat array, whose entries contain the hash key and the divisor ID.
+    The divisors receive their IDs in the order of insertion, and their literals are stored contiguously.
     (4) Array of divisor weights (pMan->vWeights), that is, the number of SOP literals to be saved by extacting each divisor.
     (5) Priority queue (pMan->vPrio), which sorts divisor (integer numbers) by their weight
     (6) Integer array (pMan->vVarCube), which maps each ObjId into the first cube of this object, 
     or -1, if there is no cubes as in the case of a primary input.
+    (7) Array of cube signatures (pMan->vSigns), which are bitmasks of hashed literals of each cube,
+    stored contiguously and used to quickly skip cube pairs whose divisors are too large.
+    (8) Integer array (pMan->vCubeObjs), which maps each cube into the ObjId of its node, 
+    so that the cubes of the same node are found without reading their literals.
 
 */
 
+#define FX_PAR_THR_MAX  100   // the max number of threads
+
+typedef struct Fx_Hsh_t_ Fx_Hsh_t;
+struct Fx_Hsh_t_
+{
+    Vec_Wrd_t *     vTable;     // hash table (hash key in the upper half, divisor ID + 1 in the lower half)
+    Vec_Int_t *     vData;      // divisor sizes followed by divisor literals
+    Vec_Int_t *     vMap;       // mapping divisor IDs into their positions in vData
+    Vec_Int_t       vTemp;      // divisor returned by Fx_HshReadEntry()
+};
+
 typedef struct Fx_Man_t_ Fx_Man_t;
 struct Fx_Man_t_
 {
@@ -90,13 +118,16 @@ struct Fx_Man_t_
     Vec_Wec_t *     vCubes;     // cube -> lit
     int             LitCountMax;// max size of divisor to extract
     int             fCanonDivs; // use only AND/XOR/MUX
+    int             nThreads;   // the number of threads to count divisors
     // internal data
     Vec_Wec_t *     vLits;      // lit -> cube
     Vec_Int_t *     vCounts;    // literal counts (currently not used)
-    Hsh_VecMan_t *  pHash;      // hash table for normalized divisors
+    Fx_Hsh_t *      pHash;      // hash table for normalized divisors
     Vec_Flt_t *     vWeights;   // divisor weights
     Vec_Que_t *     vPrio;      // priority queue for divisors by weight
     Vec_Int_t *     vVarCube;   // mapping ObjId into its first cube
+    Vec_Wrd_t *     vSigns;     // cube signatures
+    Vec_Int_t *     vCubeObjs;  // mapping cubes into their ObjIds
     Vec_Int_t *     vLevels;    // variable levels
     // temporary data to update the data-structure when a divisor is extracted
     Vec_Int_t *     vCubesS;    // single cubes for the given divisor
@@ -119,6 +150,15 @@ struct Fx_Man_t_
 
 static inline int Fx_ManGetFirstVarCube( Fx_Man_t * p, Vec_Int_t * vCube ) { return Vec_IntEntry( p->vVarCube, Vec_IntEntry(vCube, 0) ); }
 
+static inline word Fx_ManCubeSign( Vec_Int_t * vCube )
+{
+    word Sign = 0; int k, Lit;
+    Vec_IntForEachEntryStart( vCube, Lit, k, 1 )
+        Sign |= (word)1 << (((unsigned)Lit * 0x9E3779B1) >> 26);
+    return Sign;
+}
+static inline void Fx_ManUpdateSign( Fx_Man_t * p, Vec_Int_t * vCube ) { Vec_WrdWriteEntry( p->vSigns, Vec_WecLevelId(p->vCubes, vCube), Fx_ManCubeSign(vCube) ); }
+
 #define Fx_ManForEachCubeVec( vVec, vCubes, vCube, i )           \
     for ( i = 0; (i < Vec_IntSize(vVec)) && ((vCube) = Vec_WecEntry(vCubes, Vec_IntEntry(vVec, i))); i++ )
 
@@ -303,9 +343,9 @@ int Abc_NtkFxCheck( Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-int Abc_NtkFxPerform( Abc_Ntk_t * pNtk, int nNewNodesMax, int LitCountMax, int fCanonDivs, int fVerbose, int fVeryVerbose )
+int Abc_NtkFxPerform( Abc_Ntk_t * pNtk, int nNewNodesMax, int LitCountMax, int fCanonDivs, int nThreads, int fVerbose, int fVeryVerbose )
 {
-    extern int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitCountMax, int fCanonDivs, int fVerbose, int fVeryVerbose );
+    extern int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitCountMax, int fCanonDivs, int nThreads, int fVerbose, int fVeryVerbose );
     Vec_Wec_t * vCubes;
     assert( Abc_NtkIsSopLogic(pNtk) );
     // check unique fanins
@@ -317,7 +357,7 @@ int Abc_NtkFxPerform( Abc_Ntk_t * pNtk, int nNewNodesMax, int LitCountMax, int f
     // collect information about the covers
     vCubes = Abc_NtkFxRetrieve( pNtk );
     // call the fast extract procedure
-    if ( Fx_FastExtract( vCubes, Abc_NtkObjNumMax(pNtk), nNewNodesMax, LitCountMax, fCanonDivs, fVerbose, fVeryVerbose ) > 0 )
+    if ( Fx_FastExtract( vCubes, Abc_NtkObjNumMax(pNtk), nNewNodesMax, LitCountMax, fCanonDivs, nThreads, fVerbose, fVeryVerbose ) > 0 )
     {
         // update the network
         Abc_NtkFxInsert( pNtk, vCubes );
@@ -334,6 +374,102 @@ int Abc_NtkFxPerform( Abc_Ntk_t * pNtk, int nNewNodesMax, int LitCountMax, int f
 
 
 
+/**Function*************************************************************
+
+  Synopsis    [Hash table for divisors.]
+
+  Description [The table is a flat array of 64-bit entries, which is 
+  searched by linear probing. Each entry contains the hash key and 
+  the divisor ID, so that most mismatches are detected without reading 
+  the divisor literals. The array is at most half full and doubles 
+  in size, when this limit is reached.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline unsigned Fx_HshKey( int * pArray, int nSize )
+{
+    unsigned Key = (unsigned)nSize * 0x9E3779B1;
+    int i;
+    for ( i = 0; i < nSize; i++ )
+    {
+        Key = (Key ^ (unsigned)pArray[i]) * 0x85EBCA6B;
+        Key ^= Key >> 15;
+    }
+    return Key;
+}
+static inline Fx_Hsh_t * Fx_HshStart( int nSize )
+{
+    Fx_Hsh_t * p = ABC_CALLOC( Fx_Hsh_t, 1 );
+    p->vTable = Vec_WrdStart( 1 << Abc_Base2Log(Abc_MaxInt(2 * nSize, 64)) );
+    p->vData  = Vec_IntAlloc( 5 * nSize );
+    p->vMap   = Vec_IntAlloc( nSize );
+    return p;
+}
+static inline void Fx_HshStop( Fx_Hsh_t * p )
+{
+    Vec_WrdFree( p->vTable );
+    Vec_IntFree( p->vData );
+    Vec_IntFree( p->vMap );
+    ABC_FREE( p );
+}
+static inline int Fx_HshSize( Fx_Hsh_t * p )
+{
+    return Vec_IntSize( p->vMap );
+}
+static inline Vec_Int_t * Fx_HshReadEntry( Fx_Hsh_t * p, int i )
+{
+    int * pData = Vec_IntEntryP( p->vData, Vec_IntEntry(p->vMap, i) );
+    p->vTemp.nSize = p->vTemp.nCap = pData[0];
+    p->vTemp.pArray = pData + 1;
+    return &p->vTemp;
+}
+static inline void Fx_HshResize( Fx_Hsh_t * p )
+{
+    Vec_Wrd_t * vOld = p->vTable;
+    unsigned Mask = 2 * Vec_WrdSize(vOld) - 1, iSlot;
+    word * pTable, Entry;
+    int i;
+    p->vTable = Vec_WrdStart( 2 * Vec_WrdSize(vOld) );
+    pTable = Vec_WrdArray( p->vTable );
+    Vec_WrdForEachEntry( vOld, Entry, i )
+    {
+        if ( Entry == 0 )
+            continue;
+        for ( iSlot = (unsigned)(Entry >> 32) & Mask; pTable[iSlot]; iSlot = (iSlot + 1) & Mask )
+            ;
+        pTable[iSlot] = Entry;
+    }
+    Vec_WrdFree( vOld );
+}
+static inline int Fx_HshAdd( Fx_Hsh_t * p, Vec_Int_t * vVec )
+{
+    unsigned Key = Fx_HshKey( Vec_IntArray(vVec), Vec_IntSize(vVec) ), Mask, iSlot;
+    word * pTable, Entry;
+    int * pData, iDiv;
+    if ( 2 * Vec_IntSize(p->vMap) >= Vec_WrdSize(p->vTable) )
+        Fx_HshResize( p );
+    pTable = Vec_WrdArray( p->vTable );
+    Mask = Vec_WrdSize(p->vTable) - 1;
+    for ( iSlot = Key & Mask; (Entry = pTable[iSlot]); iSlot = (iSlot + 1) & Mask )
+    {
+        if ( (unsigned)(Entry >> 32) != Key )
+            continue;
+        iDiv = (int)(unsigned)Entry - 1;
+        pData = Vec_IntEntryP( p->vData, Vec_IntEntry(p->vMap, iDiv) );
+        if ( pData[0] == Vec_IntSize(vVec) && !memcmp(pData + 1, Vec_IntArray(vVec), sizeof(int) * Vec_IntSize(vVec)) )
+            return iDiv;
+    }
+    iDiv = Vec_IntSize( p->vMap );
+    pTable[iSlot] = ((word)Key << 32) | (word)(iDiv + 1);
+    Vec_IntPush( p->vMap, Vec_IntSize(p->vData) );
+    Vec_IntPush( p->vData, Vec_IntSize(vVec) );
+    Vec_IntAppend( p->vData, vVec );
+    return iDiv;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Starting the manager.]
@@ -364,10 +500,12 @@ void Fx_ManStop( Fx_Man_t * p )
 //    Vec_WecFree( p->vCubes );
     Vec_WecFree( p->vLits );
     Vec_IntFree( p->vCounts );
-    Hsh_VecManStop( p->pHash );
+    Fx_HshStop( p->pHash );
     Vec_FltFree( p->vWeights );
     Vec_QueFree( p->vPrio );
     Vec_IntFree( p->vVarCube );
+    Vec_WrdFree( p->vSigns );
+    Vec_IntFree( p->vCubeObjs );
     Vec_IntFree( p->vLevels );
     // temporary data
     Vec_IntFree( p->vCubesS );
@@ -451,11 +589,11 @@ static inline void Fx_PrintDiv( Fx_Man_t * p, int iDiv )
     printf( "%4d : ", p->nDivs );
     printf( "Div %7d : ", iDiv );
     printf( "Weight %12.5f  ", Vec_FltEntry(p->vWeights, iDiv) );
-    Fx_PrintDivArray( Hsh_VecReadEntry(p->pHash, iDiv) );
-    for ( i = Vec_IntSize(Hsh_VecReadEntry(p->pHash, iDiv)) + 3; i < 16; i++ )
+    Fx_PrintDivArray( Fx_HshReadEntry(p->pHash, iDiv) );
+    for ( i = Vec_IntSize(Fx_HshReadEntry(p->pHash, iDiv)) + 3; i < 16; i++ )
         printf( " " );
     printf( "Lits =%7d  ", p->nLits );
-    printf( "Divs =%8d  ", Hsh_VecSize(p->pHash) );
+    printf( "Divs =%8d  ", Fx_HshSize(p->pHash) );
     Abc_PrintTime( 1, "Time", Abc_Clock() - p->timeStart );
 }
 static void Fx_PrintDivisors( Fx_Man_t * p )
@@ -468,7 +606,7 @@ static void Fx_PrintStats( Fx_Man_t * p, abctime clk )
 {
     printf( "Cubes =%8d  ", Vec_WecSizeUsed(p->vCubes) );
     printf( "Lits  =%8d  ", Vec_WecSizeUsed(p->vLits) );
-    printf( "Divs  =%8d  ", Hsh_VecSize(p->pHash) );
+    printf( "Divs  =%8d  ", Fx_HshSize(p->pHash) );
     printf( "Divs+ =%8d  ", Vec_QueSize(p->vPrio) );
     printf( "Compl =%8d  ", p->nDivMux[1] );
     printf( "Extr  =%7d  ", p->nDivs );
@@ -632,6 +770,43 @@ int Fx_ManDivFindCubeFree( Vec_Int_t * vArr1, Vec_Int_t * vArr2, Vec_Int_t * vCu
     return Counter;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Checks if the cube-free divisor has more than Limit literals.]
+
+  Description [Compares the literals of the two cubes, similar to 
+  Fx_ManDivFindCubeFree(), but stops as soon as the number of different 
+  literals exceeds the limit, without deriving the divisor. This quickly 
+  filters out most of the cube pairs when the divisor size is bounded.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Fx_ManDivCubeFreeIsLarger( Vec_Int_t * vArr1, Vec_Int_t * vArr2, int Limit )
+{
+    int * pBeg1 = Vec_IntArray( vArr1 ) + 1;  // skip variable ID
+    int * pBeg2 = Vec_IntArray( vArr2 ) + 1;  // skip variable ID
+    int * pEnd1 = Vec_IntLimit( vArr1 );
+    int * pEnd2 = Vec_IntLimit( vArr2 );
+    int Counter = 0;
+    if ( Abc_AbsInt(Vec_IntSize(vArr1) - Vec_IntSize(vArr2)) > Limit )
+        return 1;
+    while ( pBeg1 < pEnd1 && pBeg2 < pEnd2 )
+    {
+        if ( *pBeg1 == *pBeg2 )
+            pBeg1++, pBeg2++;
+        else if ( *pBeg1 < *pBeg2 )
+            pBeg1++, Counter++;
+        else  
+            pBeg2++, Counter++;
+        if ( Counter > Limit )
+            return 1;
+    }
+    return Counter + (int)(pEnd1 - pBeg1) + (int)(pEnd2 - pBeg2) > Limit;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Procedures operating on a two-cube divisor.]
@@ -744,6 +919,14 @@ void Fx_ManCreateLiterals( Fx_Man_t * p, int nVars )
     Vec_WecForEachLevel( p->vCubes, vCube, i )
         if ( Vec_IntEntry(p->vVarCube, Vec_IntEntry(vCube, 0)) == -1 )
             Vec_IntWriteEntry( p->vVarCube, Vec_IntEntry(vCube, 0), i );
+    // compute cube signatures and nodes
+    p->vSigns = Vec_WrdAlloc( Vec_WecSize(p->vCubes) );
+    p->vCubeObjs = Vec_IntAlloc( Vec_WecSize(p->vCubes) );
+    Vec_WecForEachLevel( p->vCubes, vCube, i )
+    {
+        Vec_WrdPush( p->vSigns, Fx_ManCubeSign(vCube) );
+        Vec_IntPush( p->vCubeObjs, Vec_IntEntry(vCube, 0) );
+    }
 }
 int Fx_ManCubeSingleCubeDivisors( Fx_Man_t * p, Vec_Int_t * vPivot, int fRemove, int fUpdate )
 {
@@ -757,7 +940,7 @@ int Fx_ManCubeSingleCubeDivisors( Fx_Man_t * p, Vec_Int_t * vPivot, int fRemove,
         Vec_IntClear( p->vCubeFree );
         Vec_IntPush( p->vCubeFree, Abc_Var2Lit(Abc_LitNot(Lit), 0) );
         Vec_IntPush( p->vCubeFree, Abc_Var2Lit(Abc_LitNot(Lit2), 1) );
-        iDiv = Hsh_VecManAdd( p->pHash, p->vCubeFree );
+        iDiv = Fx_HshAdd( p->pHash, p->vCubeFree );
         if ( !fRemove )
         {
             if ( Vec_FltSize(p->vWeights) == iDiv )
@@ -785,9 +968,41 @@ int Fx_ManCubeSingleCubeDivisors( Fx_Man_t * p, Vec_Int_t * vPivot, int fRemove,
     }
     return Vec_IntSize(vPivot) * (Vec_IntSize(vPivot) - 1) / 2;
 }
+static inline int Fx_ManCubePairDivisor( Fx_Man_t * p, Vec_Int_t * vCube, Vec_Int_t * vPivot, word SignDiff, Vec_Int_t * vCubeFree, int * pDivMux, int * fWarning )
+{
+    int Limit = p->LitCountMax ? Abc_MaxInt(p->LitCountMax, 4) : ABC_INFINITY;
+    int Base;
+    // skip the pairs whose divisors are too large (four-literal divisors are still counted)
+    if ( p->LitCountMax && (Abc_TtCountOnes(SignDiff) > Limit || Fx_ManDivCubeFreeIsLarger(vCube, vPivot, Limit)) )
+        return -2;
+    Base = Fx_ManDivFindCubeFree( vCube, vPivot, vCubeFree, fWarning );
+    if ( Base == -1 ) 
+        return -1;
+    if ( Vec_IntSize(vCubeFree) == 4 )
+    { 
+        int Value = Fx_ManDivNormalize( vCubeFree );
+        if ( Value == 0 )
+            pDivMux[0]++;
+        else if ( Value == 1 )
+            pDivMux[1]++;
+        else
+            pDivMux[2]++;
+        if ( p->fCanonDivs && Value < 0 )
+            return -2;
+    }
+    if ( p->LitCountMax && p->LitCountMax < Vec_IntSize(vCubeFree) )
+        return -2;
+    if ( p->fCanonDivs && Vec_IntSize(vCubeFree) == 3 )
+        return -2;
+    return Base;
+}
 void Fx_ManCubeDoubleCubeDivisors( Fx_Man_t * p, int iFirst, Vec_Int_t * vPivot, int fRemove, int fUpdate, int * fWarning )
 {
     Vec_Int_t * vCube;
+    word * pSigns = Vec_WrdArray( p->vSigns );
+    word SignPivot = pSigns[Vec_WecLevelId(p->vCubes, vPivot)];
+    int * pObjs = Vec_IntArray( p->vCubeObjs );
+    int iObj = pObjs[Vec_WecLevelId(p->vCubes, vPivot)];
     int i, iDiv, Base;
     Vec_WecForEachLevelStart( p->vCubes, vCube, i, iFirst )
     {
@@ -795,9 +1010,11 @@ void Fx_ManCubeDoubleCubeDivisors( Fx_Man_t * p, int iFirst, Vec_Int_t * vPivot,
             continue;
         if ( Vec_WecIntHasMark(vCube) && Vec_WecIntHasMark(vPivot) && vCube > vPivot )
             continue;
-        if ( Vec_IntEntry(vCube, 0) != Vec_IntEntry(vPivot, 0) )
+        if ( pObjs[i] != iObj )
             break;
-        Base = Fx_ManDivFindCubeFree( vCube, vPivot, p->vCubeFree, fWarning );
+        Base = Fx_ManCubePairDivisor( p, vCube, vPivot, pSigns[i] ^ SignPivot, p->vCubeFree, p->nDivMux, fWarning );
+        if ( Base == -2 )
+            continue;
         if ( Base == -1 ) 
         {
             if ( fRemove == 0 )
@@ -809,23 +1026,7 @@ void Fx_ManCubeDoubleCubeDivisors( Fx_Man_t * p, int iFirst, Vec_Int_t * vPivot,
             }
             continue;
         }
-        if ( Vec_IntSize(p->vCubeFree) == 4 )
-        { 
-            int Value = Fx_ManDivNormalize( p->vCubeFree );
-            if ( Value == 0 )
-                p->nDivMux[0]++;
-            else if ( Value == 1 )
-                p->nDivMux[1]++;
-            else
-                p->nDivMux[2]++;
-            if ( p->fCanonDivs && Value < 0 )
-                continue;
-        }
-        if ( p->LitCountMax && p->LitCountMax < Vec_IntSize(p->vCubeFree) )
-            continue;
-        if ( p->fCanonDivs && Vec_IntSize(p->vCubeFree) == 3 )
-            continue;
-        iDiv = Hsh_VecManAdd( p->pHash, p->vCubeFree );
+        iDiv = Fx_HshAdd( p->pHash, p->vCubeFree );
         if ( !fRemove )
         {
             if ( iDiv == Vec_FltSize(p->vWeights) )
@@ -849,6 +1050,179 @@ void Fx_ManCubeDoubleCubeDivisors( Fx_Man_t * p, int iFirst, Vec_Int_t * vPivot,
         }
     } 
 }
+/**Function*************************************************************
+
+  Synopsis    [Counts two-cube divisors using several threads.]
+
+  Description [The cubes are divided into ranges, which have about the 
+  same number of cube pairs. Each thread considers the pairs of cubes 
+  whose first cube is in its range, hashes the divisors into its own 
+  table, and records the weight contributed by each pair. The main 
+  thread then adds the divisors of each range to the manager and 
+  replays the recorded contributions in the order of the ranges. 
+  In this way, the divisors receive the same IDs and the same weights 
+  as when they are counted by one thread, so the result does not 
+  depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Fx_ManCreateDivisorsParCheck( Fx_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    return p->nThreads > 1;
+#else
+    return 0;
+#endif
+}
+
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Fx_ParThData_t_ Fx_ParThData_t;
+struct Fx_ParThData_t_
+{
+    Fx_Man_t *       p;              // the manager (only read by the thread)
+    int              iCubeBeg;       // the first pivot cube
+    int              iCubeEnd;       // the cube following the last pivot cube
+    Fx_Hsh_t *       pHash;          // the divisors found by the thread
+    Vec_Int_t *      vPairs;         // the divisor and the weight of each cube pair
+    Vec_Int_t *      vCubeFree;      // cube-free divisor
+    Vec_Int_t *      vSCC;           // single cubes containment cubes
+    int              nPairsD;        // number of cube pairs
+    int              nDivMux[3];     // 0 = mux, 1 = compl mux, 2 = no mux
+    int              fWarning;       // duplicated cubes are found
+};
+
+void * Fx_ManCreateDivisorsThread( void * pArg )
+{
+    Fx_ParThData_t * pThData = (Fx_ParThData_t *)pArg;
+    Fx_Man_t * p = pThData->p;
+    word * pSigns = Vec_WrdArray( p->vSigns );
+    int * pObjs = Vec_IntArray( p->vCubeObjs );
+    Vec_Int_t * vPivot, * vCube;
+    int i, k, iDiv, Base;
+    for ( i = pThData->iCubeBeg; i < pThData->iCubeEnd; i++ )
+    {
+        vPivot = Vec_WecEntry( p->vCubes, i );
+        Vec_WecForEachLevelStart( p->vCubes, vCube, k, i+1 )
+        {
+            if ( pObjs[k] != pObjs[i] )
+                break;
+            Base = Fx_ManCubePairDivisor( p, vCube, vPivot, pSigns[k] ^ pSigns[i], pThData->vCubeFree, pThData->nDivMux, &pThData->fWarning );
+            if ( Base == -2 )
+                continue;
+            if ( Base == -1 ) 
+            {
+                Vec_IntPush( pThData->vSCC, Vec_IntSize(vCube) > Vec_IntSize(vPivot) ? k : i );
+                continue;
+            }
+            iDiv = Fx_HshAdd( pThData->pHash, pThData->vCubeFree );
+            Vec_IntPushTwo( pThData->vPairs, iDiv, Base + Vec_IntSize(pThData->vCubeFree) - 1 );
+            pThData->nPairsD++;
+        }
+    }
+    return NULL;
+}
+void Fx_ManCreateDivisorsPar( Fx_Man_t * p, int * fWarning )
+{
+    pthread_t WorkerThread[FX_PAR_THR_MAX];
+    Fx_ParThData_t ThData[FX_PAR_THR_MAX];
+    Vec_Int_t * vMap = Vec_IntAlloc( 1000 ), * vDiv;
+    int * pObjs = Vec_IntArray( p->vCubeObjs );
+    int nCubes = Vec_WecSize( p->vCubes );
+    int nThreads = Abc_MinInt( p->nThreads, FX_PAR_THR_MAX );
+    int i, k, c, iStop, iDiv, Weight, status;
+    word nPairs = 0, nPairsCur = 0;
+    // count cube pairs
+    for ( i = 0; i < nCubes; i = iStop )
+    {
+        for ( iStop = i + 1; iStop < nCubes && pObjs[iStop] == pObjs[i]; iStop++ )
+            ;
+        nPairs += (word)(iStop - i) * (iStop - i - 1) / 2;
+    }
+    // divide the cubes into ranges with about the same number of pairs
+    memset( ThData, 0, sizeof(Fx_ParThData_t) * nThreads );
+    for ( k = i = 0; i < nCubes; i = iStop )
+    {
+        for ( iStop = i + 1; iStop < nCubes && pObjs[iStop] == pObjs[i]; iStop++ )
+            ;
+        for ( c = i; c < iStop; c++ )
+        {
+            nPairsCur += iStop - c - 1;
+            while ( k < nThreads - 1 && nPairsCur * nThreads >= nPairs * (k + 1) )
+                ThData[k++].iCubeEnd = c + 1;
+        }
+    }
+    for ( ; k < nThreads; k++ )
+        ThData[k].iCubeEnd = nCubes;
+    for ( k = 0; k < nThreads; k++ )
+    {
+        ThData[k].p         = p;
+        ThData[k].iCubeBeg  = k ? ThData[k-1].iCubeEnd : 0;
+        ThData[k].pHash     = Fx_HshStart( 1000 );
+        ThData[k].vPairs    = Vec_IntAlloc( 1000 );
+        ThData[k].vCubeFree = Vec_IntAlloc( 100 );
+        ThData[k].vSCC      = Vec_IntAlloc( 100 );
+    }
+    // count the divisors (the main thread is used as the last worker)
+    for ( k = 0; k < nThreads - 1; k++ )
+    {
+        status = pthread_create( WorkerThread + k, NULL, Fx_ManCreateDivisorsThread, (void *)(ThData + k) );  
+        assert( status == 0 );
+    }
+    Fx_ManCreateDivisorsThread( (void *)(ThData + nThreads - 1) );
+    for ( k = 0; k < nThreads - 1; k++ )
+    {
+        status = pthread_join( WorkerThread[k], NULL );  
+        assert( status == 0 );
+    }
+    // add the divisors in the order of the ranges
+    for ( k = 0; k < nThreads; k++ )
+    {
+        Vec_IntClear( vMap );
+        for ( i = 0; i < Fx_HshSize(ThData[k].pHash); i++ )
+        {
+            vDiv = Fx_HshReadEntry( ThData[k].pHash, i );
+            iDiv = Fx_HshAdd( p->pHash, vDiv );
+            if ( iDiv == Vec_FltSize(p->vWeights) )
+                Vec_FltPush(p->vWeights, -Vec_IntSize(vDiv) + 0.9 - 0.0009 * Fx_ManComputeLevelDiv(p, vDiv));
+            Vec_IntPush( vMap, iDiv );
+        }
+        Vec_IntForEachEntryDouble( ThData[k].vPairs, iDiv, Weight, i )
+            Vec_FltAddToEntry( p->vWeights, Vec_IntEntry(vMap, iDiv), Weight );
+        Vec_IntAppend( p->vSCC, ThData[k].vSCC );
+        p->nPairsD    += ThData[k].nPairsD;
+        p->nDivMux[0] += ThData[k].nDivMux[0];
+        p->nDivMux[1] += ThData[k].nDivMux[1];
+        p->nDivMux[2] += ThData[k].nDivMux[2];
+        *fWarning     |= ThData[k].fWarning;
+        Fx_HshStop( ThData[k].pHash );
+        Vec_IntFree( ThData[k].vPairs );
+        Vec_IntFree( ThData[k].vCubeFree );
+        Vec_IntFree( ThData[k].vSCC );
+    }
+    Vec_IntFree( vMap );
+}
+
+#else
+
+void Fx_ManCreateDivisorsPar( Fx_Man_t * p, int * fWarning ) {}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the divisors.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void Fx_ManCreateDivisors( Fx_Man_t * p )
 {
     Vec_Int_t * vCube;
@@ -856,15 +1230,20 @@ void Fx_ManCreateDivisors( Fx_Man_t * p )
     int i, fWarning = 0;
     // alloc hash table
     assert( p->pHash == NULL );
-    p->pHash = Hsh_VecManStart( 1000 );
+    p->pHash = Fx_HshStart( 1000 );
     p->vWeights = Vec_FltAlloc( 1000 );
     // create single-cube two-literal divisors
     Vec_WecForEachLevel( p->vCubes, vCube, i )
         Fx_ManCubeSingleCubeDivisors( p, vCube, 0, 0 ); // add - no update
     assert( p->nDivsS == Vec_FltSize(p->vWeights) );
     // create two-cube divisors
-    Vec_WecForEachLevel( p->vCubes, vCube, i )
-        Fx_ManCubeDoubleCubeDivisors( p, i+1, vCube, 0, 0, &fWarning ); // add - no update
+    if ( Fx_ManCreateDivisorsParCheck(p) )
+        Fx_ManCreateDivisorsPar( p, &fWarning );
+    else
+    {
+        Vec_WecForEachLevel( p->vCubes, vCube, i )
+            Fx_ManCubeDoubleCubeDivisors( p, i+1, vCube, 0, 0, &fWarning ); // add - no update
+    }
     // create queue with all divisors
     p->vPrio = Vec_QueAlloc( Vec_FltSize(p->vWeights) );
     Vec_QueSetPriority( p->vPrio, Vec_FltArrayP(p->vWeights) );
@@ -906,9 +1285,11 @@ static inline void Fx_ManCompressCubes( Vec_Wec_t * vCubes, Vec_Int_t * vLit2Cub
   SeeAlso     []
 
 ***********************************************************************/
-static inline int Fx_ManGetCubeVar( Vec_Wec_t * vCubes, int iCube )  { return Vec_IntEntry( Vec_WecEntry(vCubes, iCube), 0 );      }
-void Fx_ManFindCommonPairs( Vec_Wec_t * vCubes, Vec_Int_t * vPart0, Vec_Int_t * vPart1, Vec_Int_t * vPairs, Vec_Int_t * vCompls, Vec_Int_t * vDiv, Vec_Int_t * vCubeFree, int * fWarning )
+static inline int Fx_ManGetCubeVar( Vec_Int_t * vCubeObjs, int iCube )  { return Vec_IntEntry( vCubeObjs, iCube );      }
+void Fx_ManFindCommonPairs( Vec_Wec_t * vCubes, Vec_Int_t * vCubeObjs, Vec_Wrd_t * vSigns, Vec_Int_t * vPart0, Vec_Int_t * vPart1, Vec_Int_t * vPairs, Vec_Int_t * vCompls, Vec_Int_t * vDiv, Vec_Int_t * vCubeFree, int * fWarning )
 {
+    word * pSigns = Vec_WrdArray( vSigns );
+    int Limit = Abc_MaxInt( Vec_IntSize(vDiv), 3 );
     int * pBeg1 = vPart0->pArray;
     int * pBeg2 = vPart1->pArray;
     int * pEnd1 = vPart0->pArray + vPart0->nSize;
@@ -918,21 +1299,25 @@ void Fx_ManFindCommonPairs( Vec_Wec_t * vCubes, Vec_Int_t * vPart0, Vec_Int_t *
     Vec_IntClear( vCompls );
     while ( pBeg1 < pEnd1 && pBeg2 < pEnd2 )
     {
-        CubeId1 = Fx_ManGetCubeVar(vCubes, *pBeg1);
-        CubeId2 = Fx_ManGetCubeVar(vCubes, *pBeg2);
+        CubeId1 = Fx_ManGetCubeVar(vCubeObjs, *pBeg1);
+        CubeId2 = Fx_ManGetCubeVar(vCubeObjs, *pBeg2);
         if ( CubeId1 == CubeId2 )
         {
             for ( i = 1; pBeg1+i < pEnd1; i++ )
-                if ( CubeId1 != Fx_ManGetCubeVar(vCubes, pBeg1[i]) )
+                if ( CubeId1 != Fx_ManGetCubeVar(vCubeObjs, pBeg1[i]) )
                     break;
             for ( k = 1; pBeg2+k < pEnd2; k++ )
-                if ( CubeId1 != Fx_ManGetCubeVar(vCubes, pBeg2[k]) )
+                if ( CubeId1 != Fx_ManGetCubeVar(vCubeObjs, pBeg2[k]) )
                     break;
             for ( i_ = 0; i_ < i; i_++ )
             for ( k_ = 0; k_ < k; k_++ )
             {
                 if ( pBeg1[i_] == pBeg2[k_] )
                     continue;
+                if ( Abc_TtCountOnes(pSigns[pBeg1[i_]] ^ pSigns[pBeg2[k_]]) > Limit )
+                    continue;
+                if ( Fx_ManDivCubeFreeIsLarger( Vec_WecEntry(vCubes, pBeg1[i_]), Vec_WecEntry(vCubes, pBeg2[k_]), Limit ) )
+                    continue;
                 Fx_ManDivFindCubeFree( Vec_WecEntry(vCubes, pBeg1[i_]), Vec_WecEntry(vCubes, pBeg2[k_]), vCubeFree, fWarning );
                 fCompl = (Vec_IntSize(vCubeFree) == 4 && Fx_ManDivNormalize(vCubeFree) == 1);
                 if ( !Vec_IntEqual( vDiv, vCubeFree ) )
@@ -973,7 +1358,7 @@ void Fx_ManUpdate( Fx_Man_t * p, int iDiv, int * fWarning )
     // get the divisor and select pivot variables
     p->nDivs++;
     Vec_IntClear( vDiv );
-    Vec_IntAppend( vDiv, Hsh_VecReadEntry(p->pHash, iDiv) );
+    Vec_IntAppend( vDiv, Fx_HshReadEntry(p->pHash, iDiv) );
     Fx_ManDivFindPivots( vDiv, &Lit0, &Lit1 );
     assert( Lit0 >= 0 && Lit1 >= 0 );
 
@@ -990,7 +1375,7 @@ void Fx_ManUpdate( Fx_Man_t * p, int iDiv, int * fWarning )
     // collect double-cube-divisor cube pairs
     Fx_ManCompressCubes( p->vCubes, Vec_WecEntry(p->vLits, Lit0) );
     Fx_ManCompressCubes( p->vCubes, Vec_WecEntry(p->vLits, Lit1) );
-    Fx_ManFindCommonPairs( p->vCubes, Vec_WecEntry(p->vLits, Lit0), Vec_WecEntry(p->vLits, Lit1), p->vCubesD, p->vCompls, vDiv, p->vCubeFree, fWarning );
+    Fx_ManFindCommonPairs( p->vCubes, p->vCubeObjs, p->vSigns, Vec_WecEntry(p->vLits, Lit0), Vec_WecEntry(p->vLits, Lit1), p->vCubesD, p->vCompls, vDiv, p->vCubeFree, fWarning );
 
     // subtract cost of single-cube divisors
     Fx_ManForEachCubeVec( p->vCubesS, p->vCubes, vCube, i )
@@ -1012,7 +1397,7 @@ void Fx_ManUpdate( Fx_Man_t * p, int iDiv, int * fWarning )
     Vec_WecUnmarkLevels( p->vCubes, p->vCubesS );
     Vec_WecUnmarkLevels( p->vCubes, p->vCubesD );
 
-    if ( Abc_Lit2Var(Lit0) == Abc_Lit2Var(Lit1) && Vec_IntSize(Hsh_VecReadEntry(p->pHash, iDiv)) == 2 )
+    if ( Abc_Lit2Var(Lit0) == Abc_Lit2Var(Lit1) && Vec_IntSize(Fx_HshReadEntry(p->pHash, iDiv)) == 2 )
         goto ExtractFromPairs;
 
     // create new divisor
@@ -1037,6 +1422,11 @@ void Fx_ManUpdate( Fx_Man_t * p, int iDiv, int * fWarning )
     }
     assert( Vec_IntSize(p->vLevels) == iVarNew );
     Vec_IntPush( p->vLevels, Level );
+    while ( Vec_WrdSize(p->vSigns) < Vec_WecSize(p->vCubes) )
+    {
+        Vec_WrdPush( p->vSigns, Fx_ManCubeSign(Vec_WecEntry(p->vCubes, Vec_WrdSize(p->vSigns))) );
+        Vec_IntPush( p->vCubeObjs, iVarNew );
+    }
     // do not add new cubes to the matrix 
     p->nLits += Vec_IntSize( vDiv );
     // create new literals
@@ -1051,6 +1441,7 @@ void Fx_ManUpdate( Fx_Man_t * p, int iDiv, int * fWarning )
         assert( RetValue == 2 );
         Vec_IntPush( vCube, Abc_Var2Lit(iVarNew, 0) );
         Vec_IntPush( vLitP, Vec_WecLevelId(p->vCubes, vCube) );
+        Fx_ManUpdateSign( p, vCube );
         p->nLits--;
     }
     // create updated double-cube divisor cube pairs
@@ -1082,6 +1473,7 @@ ExtractFromPairs:
             }
         }
         p->nLits -= Vec_IntSize(vDiv) + Vec_IntSize(vCube2) - 2;
+        Fx_ManUpdateSign( p, vCube );
 
         // remove second cube
         Vec_IntWriteEntry( p->vCubesD, k++, Vec_WecLevelId(p->vCubes, vCube) );
@@ -1160,7 +1552,7 @@ ExtractFromPairs:
   SeeAlso     []
 
 ***********************************************************************/
-int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitCountMax, int fCanonDivs, int fVerbose, int fVeryVerbose )
+int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitCountMax, int fCanonDivs, int nThreads, int fVerbose, int fVeryVerbose )
 {
     int fVeryVeryVerbose = 0;
     int i, iDiv, fWarning = 0;
@@ -1170,6 +1562,7 @@ int Fx_FastExtract( Vec_Wec_t * vCubes, int ObjIdMax, int nNewNodesMax, int LitC
     p = Fx_ManStart( vCubes );
     p->LitCountMax = LitCountMax;
     p->fCanonDivs = fCanonDivs;
+    p->nThreads = nThreads;
     Fx_ManCreateLiterals( p, ObjIdMax );
     Fx_ManComputeLevel( p );
     Fx_ManCreateDivisors( p );
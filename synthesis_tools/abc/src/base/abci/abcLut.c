@@ -53,7 +53,7 @@ struct Abc_ManScl_t_
     unsigned **        uCofs;       // truth tables of the cofactors
 };
 
-static Vec_Ptr_t * s_pLeaves = NULL;
+static ABC_THREAD_LOCAL Vec_Ptr_t * s_pLeaves = NULL;
 
 static Cut_Man_t * Abc_NtkStartCutManForScl( Abc_Ntk_t * pNtk, int nLutSize );
 static Abc_ManScl_t * Abc_ManSclStart( int nLutSize, int nCutSizeMax, int nNodesMax );
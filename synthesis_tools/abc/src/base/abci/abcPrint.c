@@ -69,7 +69,7 @@ abctime s_ResynTime = 0;
 int Abc_NtkCompareAndSaveBest( Abc_Ntk_t * pNtk )
 {
     extern void Io_Write( Abc_Ntk_t * pNtk, char * pFileName, Io_FileType_t FileType );
-    static struct ParStruct {
+    static ABC_THREAD_LOCAL struct ParStruct {
         char * pName;  // name of the best saved network
         int    Depth;  // depth of the best saved network
         int    Flops;  // flops in the best saved network 
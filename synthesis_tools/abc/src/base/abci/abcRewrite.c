@@ -95,9 +95,20 @@ int Abc_NtkRewrite( Abc_Ntk_t * pNtk, int fUpdateLevel, int fUseZeros, int fVerb
     // compute the reverse levels if level update is requested
     if ( fUpdateLevel )
         Abc_NtkStartReverseLevels( pNtk, 0 );
-    // start the cut manager
+    // start the cut manager or reuse the one saved by the previous call
 clk = Abc_Clock();
-    pManCut = Abc_NtkStartCutManForRewrite( pNtk );
+    if ( pNtk->pManCutRwr && Abc_NtkIsDfsOrdered(pNtk) )
+    {
+        pManCut = (Cut_Man_t *)pNtk->pManCutRwr;
+        pManRwr->nNodesReused = Abc_NtkUpdateCuts( pManCut, pNtk );
+    }
+    else
+    {
+        if ( pNtk->pManCutRwr )
+            Cut_ManStop( (Cut_Man_t *)pNtk->pManCutRwr );
+        pManCut = Abc_NtkStartCutManForRewrite( pNtk );
+    }
+    pNtk->pManCutRwr = NULL;
 Rwr_ManAddTimeCuts( pManRwr, Abc_Clock() - clk );
     pNtk->pManCut = pManCut;
 
@@ -155,10 +166,10 @@ Rwr_ManAddTimeTotal( pManRwr, Abc_Clock() - clkStart );
 //        Rwr_ManPrintStatsFile( pManRwr );
     if ( fVeryVerbose )
         Rwr_ScoresReport( pManRwr );
-    // delete the managers
+    // delete the manager and save the cuts for the next call
     Rwr_ManStop( pManRwr );
-    Cut_ManStop( pManCut );
     pNtk->pManCut = NULL;
+    pNtk->pManCutRwr = pManCut;
 
     // start placement package
 //    if ( fPlaceEnable )
@@ -214,6 +225,7 @@ Cut_Man_t * Abc_NtkStartCutManForRewrite( Abc_Ntk_t * pNtk )
     pParams->fFilter   = 1;     // filter dominated cuts
     pParams->fSeq      = 0;     // compute sequential cuts
     pParams->fDrop     = 0;     // drop cuts on the fly
+    pParams->fFanins   = 1;     // record the fanins (for incremental update)
     pParams->fVerbose  = 0;     // the verbosiness flag
     pParams->nIdsMax   = Abc_NtkObjNumMax( pNtk );
     pManCut = Cut_ManStart( pParams );
@@ -27,6 +27,9 @@
 #include "aig/saig/saig.h"
 #include "aig/gia/gia.h"
 #include "proof/ssw/ssw.h"
+#include "proof/cec/cec.h"
+#include "proof/acec/acec.h"
+#include "aig/gia/giaAig.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -241,6 +244,159 @@ void Abc_NtkCecFraig( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nSeconds, int fV
     Abc_NtkDelete( pMiter );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives the dual-output miter of the two networks.]
+
+  Description [The CIs/COs are matched by name in the strashed copies,
+  which are returned to be used for reporting the counter-example.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Gia_Man_t * Abc_NtkCecDeriveGiaMiter( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, Abc_Ntk_t ** ppStr1, Abc_Ntk_t ** ppStr2 )
+{
+    extern Aig_Man_t * Abc_NtkToDar( Abc_Ntk_t * pNtk, int fExors, int fRegisters );
+    Abc_Ntk_t * pStr1, * pStr2;
+    Aig_Man_t * pAig1, * pAig2;
+    Gia_Man_t * pGia1, * pGia2, * pMiter;
+    // order the CIs/COs of the copies by name, leaving the original networks intact
+    pStr1 = Abc_NtkStrash( pNtk1, 0, 1, 0 );
+    pStr2 = Abc_NtkStrash( pNtk2, 0, 1, 0 );
+    if ( !Abc_NtkCompareSignals( pStr1, pStr2, 0, 1 ) )
+    {
+        Abc_NtkDelete( pStr1 );
+        Abc_NtkDelete( pStr2 );
+        return NULL;
+    }
+    pAig1 = Abc_NtkToDar( pStr1, 0, 0 );
+    pAig2 = Abc_NtkToDar( pStr2, 0, 0 );
+    pGia1 = Gia_ManFromAig( pAig1 );
+    pGia2 = Gia_ManFromAig( pAig2 );
+    Aig_ManStop( pAig1 );
+    Aig_ManStop( pAig2 );
+    pMiter = Gia_ManMiter( pGia1, pGia2, 0, 1, 0, 0, 0 );
+    Gia_ManStop( pGia1 );
+    Gia_ManStop( pGia2 );
+    if ( pMiter == NULL )
+    {
+        Abc_NtkDelete( pStr1 );
+        Abc_NtkDelete( pStr2 );
+        return NULL;
+    }
+    *ppStr1 = pStr1;
+    *ppStr2 = pStr2;
+    return pMiter;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Verifies combinational equivalence using parallel SAT sweeping.]
+
+  Description [Derives the dual-output miter of the two networks and
+  proves it with the new CEC engine, which distributes the SAT calls
+  of each sweeping round among nProcs threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_NtkCecParallel( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int nSeconds, int nConfLimit, int nProcs, int fVerbose )
+{
+    Cec_ParCec_t ParsCec, * pPars = &ParsCec;
+    Abc_Ntk_t * pStr1, * pStr2;
+    Gia_Man_t * pMiter;
+    abctime clk = Abc_Clock();
+    int RetValue;
+    pMiter = Abc_NtkCecDeriveGiaMiter( pNtk1, pNtk2, &pStr1, &pStr2 );
+    if ( pMiter == NULL )
+    {
+        printf( "Miter computation has failed.\n" );
+        return;
+    }
+    // prove the miter
+    Cec_ManCecSetDefaultParams( pPars );
+    pPars->nBTLimit  = nConfLimit;
+    pPars->TimeLimit = nSeconds;
+    pPars->nProcs    = nProcs;
+    pPars->fSilent   = 1;
+    pPars->fVerbose  = fVerbose;
+    RetValue = Cec_ManVerify( pMiter, pPars );
+    if ( RetValue == -1 )
+        printf( "Networks are undecided (resource limits is reached).  " );
+    else if ( RetValue == 0 )
+        printf( "Networks are NOT EQUIVALENT.  " );
+    else
+        printf( "Networks are equivalent.  " );
+    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    if ( RetValue == 0 && pMiter->pCexComb )
+    {
+        int i, * pModel = ABC_ALLOC( int, Abc_NtkCiNum(pStr1) );
+        for ( i = 0; i < Abc_NtkCiNum(pStr1); i++ )
+            pModel[i] = Abc_InfoHasBit( pMiter->pCexComb->pData, pMiter->pCexComb->nRegs + i );
+        Abc_NtkVerifyReportError( pStr1, pStr2, pModel );
+        ABC_FREE( pModel );
+    }
+    Gia_ManStop( pMiter );
+    Abc_NtkDelete( pStr1 );
+    Abc_NtkDelete( pStr2 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Verifies arithmetic circuits by algebraic rewriting.]
+
+  Description [If the miter contains enough full adders to look like
+  an adder or a multiplier, the word-level signature of the miter is
+  rewritten backward into a polynomial in terms of the inputs, which 
+  is zero if and only if the networks are equivalent. Returns 1 if the
+  networks are proved equivalent. Otherwise returns 0, and the caller
+  continues with the regular engine, which handles the non-arithmetic
+  logic and derives the counter-example when the networks differ.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_NtkCecArith( Abc_Ntk_t * pNtk1, Abc_Ntk_t * pNtk2, int fVerbose )
+{
+    Abc_Ntk_t * pStr1, * pStr2;
+    Gia_Man_t * pMiter;
+    Vec_Int_t * vFadds;
+    abctime clk = Abc_Clock();
+    int nFadds, RetValue = -1;
+    pMiter = Abc_NtkCecDeriveGiaMiter( pNtk1, pNtk2, &pStr1, &pStr2 );
+    if ( pMiter == NULL )
+        return 0;
+    // the adders should be responsible for a noticeable part of the logic,
+    // while the rewriting quits early when the monomials start to blow up
+    vFadds = Gia_ManDetectFullAdders( pMiter, 0, NULL );
+    nFadds = Vec_IntSize(vFadds) / 5;
+    Vec_IntFree( vFadds );
+    if ( fVerbose )
+        printf( "Miter has %d nodes and %d full adders.\n", Gia_ManAndNum(pMiter), nFadds );
+    if ( nFadds > 0 && 20 * nFadds >= Gia_ManAndNum(pMiter) )
+        RetValue = Gia_PolynVerifyMiter( pMiter, Abc_MaxInt(10000, 10 * Gia_ManAndNum(pMiter)), fVerbose );
+    if ( RetValue == 1 )
+    {
+        printf( "Networks are equivalent after algebraic rewriting.  " );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    else if ( fVerbose )
+    {
+        printf( "Algebraic rewriting has %s.  ", RetValue == 0 ? "found a difference" : "not succeeded" );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    Gia_ManStop( pMiter );
+    Abc_NtkDelete( pStr1 );
+    Abc_NtkDelete( pStr2 );
+    return RetValue == 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Verifies sequential equivalence by fraiging followed by SAT.]
@@ -61,6 +61,7 @@ static int CmdCommandMvsis         ( Abc_Frame_t * pAbc, int argc, char ** argv
 static int CmdCommandCapo          ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandStarter       ( Abc_Frame_t * pAbc, int argc, char ** argv );
 static int CmdCommandAutoTuner     ( Abc_Frame_t * pAbc, int argc, char ** argv );
+static int CmdCommandPScript       ( Abc_Frame_t * pAbc, int argc, char ** argv );
 
 extern int Cmd_CommandAbcLoadPlugIn( Abc_Frame_t * pAbc, int argc, char ** argv );
 
@@ -112,6 +113,7 @@ void Cmd_Init( Abc_Frame_t * pAbc )
     Cmd_CommandAdd( pAbc, "Various", "capo",        CmdCommandCapo,            0 );
     Cmd_CommandAdd( pAbc, "Various", "starter",     CmdCommandStarter,         0 );
     Cmd_CommandAdd( pAbc, "Various", "autotuner",   CmdCommandAutoTuner,       0 );
+    Cmd_CommandAdd( pAbc, "Various", "pscript",     CmdCommandPScript,         1 );
 
     Cmd_CommandAdd( pAbc, "Various", "load_plugin", Cmd_CommandAbcLoadPlugIn,  0 );
 }
@@ -2565,6 +2567,102 @@ usage:
     return 1;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Command to run alternative scripts concurrently.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int CmdCommandPScript( Abc_Frame_t * pAbc, int argc, char ** argv )
+{
+    extern int Cmd_RunPScript( Abc_Frame_t * pAbc, char * pFileName, int nProcs, int Metric, int fVerbose );
+    char * pMetrics[3] = { "nodes", "levels", "delay" };
+    char * pFileName = NULL;
+    int c, nProcs    =  4;
+    int Metric       =  0;
+    int fVerbose     =  0;
+    Extra_UtilGetoptReset();
+    while ( ( c = Extra_UtilGetopt( argc, argv, "nfmvh" ) ) != EOF )
+    {
+        switch ( c )
+        {
+        case 'n':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-n\" should be followed by an integer.\n" );
+                goto usage;
+            }
+            nProcs = atoi(argv[globalUtilOptind]);
+            globalUtilOptind++;
+            if ( nProcs <= 0 ) 
+                goto usage;
+            break;
+        case 'f':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-f\" should be followed by a file name.\n" );
+                goto usage;
+            }
+            pFileName = argv[globalUtilOptind];
+            globalUtilOptind++;
+            break;
+        case 'm':
+            if ( globalUtilOptind >= argc )
+            {
+                Abc_Print( -1, "Command line switch \"-m\" should be followed by \"nodes\", \"levels\", or \"delay\".\n" );
+                goto usage;
+            }
+            for ( Metric = 0; Metric < 3; Metric++ )
+                if ( !strcmp(argv[globalUtilOptind], pMetrics[Metric]) )
+                    break;
+            globalUtilOptind++;
+            if ( Metric == 3 )
+            {
+                Abc_Print( -1, "Unknown metric \"%s\".\n", argv[globalUtilOptind-1] );
+                Metric = 0;
+                goto usage;
+            }
+            break;
+        case 'v':
+            fVerbose ^= 1;
+            break;
+        case 'h':
+            goto usage;
+        default:
+            goto usage;
+        }
+    }
+    if ( pFileName == NULL && argc == globalUtilOptind + 1 )
+        pFileName = argv[globalUtilOptind];
+    if ( pFileName == NULL )
+    {
+        Abc_Print( -2, "The file with the scripts is not given.\n" );
+        return 1;
+    }
+    if ( !Cmd_RunPScript( pAbc, pFileName, nProcs, Metric, fVerbose ) )
+        return 1;
+    return 0;
+
+usage:
+    Abc_Print( -2, "usage: pscript [-n num] [-f file] [-m metric] [-vh]\n" );
+    Abc_Print( -2, "\t           applies each script to a copy of the current network,\n" );
+    Abc_Print( -2, "\t           runs up to <num> scripts at a time, and keeps the best result\n" );
+    Abc_Print( -2, "\t           (each script runs in a separate thread and framework, which starts\n" );
+    Abc_Print( -2, "\t           with the aliases, variables, and copies of the libraries of this one)\n" );
+    Abc_Print( -2, "\t-n num   : the number of concurrently running scripts [default = %d]\n", nProcs );
+    Abc_Print( -2, "\t-f file  : the file with the scripts, one per line (lines starting with # are skipped)\n" );
+    Abc_Print( -2, "\t-m metric: the quality metric (\"nodes\", \"levels\", or \"delay\") [default = %s]\n", pMetrics[Metric] );
+    Abc_Print( -2, "\t           (for mapped networks, \"nodes\" compares the area and \"delay\" the mapped delay)\n" );
+    Abc_Print( -2, "\t-v       : toggle printing verbose information [default = %s]\n", fVerbose? "yes": "no" );
+    Abc_Print( -2, "\t-h       : print the command usage\n");
+    return 1;
+}
+
 /**Function********************************************************************
 
   Synopsis    [Print the version string.]
@@ -242,9 +242,9 @@ satoko_opts_t * Cmd_DeriveOptionFromSettings( int argc, char ** argv )
     satoko_default_opts(&opts);
     Extra_UtilGetoptReset();
 #ifdef SATOKO_ACT_VAR_FIXED
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CPDEFGHIJKLMNOQRSTUhv" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CPDEFGHIJKLMNOQRSTUABXhv" ) ) != EOF )
 #else
-    while ( ( c = Extra_UtilGetopt( argc, argv, "CPDEFGHIJKLMNOQRShv" ) ) != EOF )
+    while ( ( c = Extra_UtilGetopt( argc, argv, "CPDEFGHIJKLMNOQRSABXhv" ) ) != EOF )
 #endif
     {
         switch ( c )
@@ -418,6 +418,33 @@ satoko_opts_t * Cmd_DeriveOptionFromSettings( int argc, char ** argv )
                if ( opts.var_decay < 0 )
                    return NULL;
                break;
+         case 'A':
+               if ( globalUtilOptind >= argc )
+               {
+                   Abc_Print( -1, "Command line switch \"-A\" should be followed by an integer.\n" );
+                   return NULL;
+               }
+               opts.n_conf_inprocess = (unsigned)atoi(argv[globalUtilOptind]);
+               globalUtilOptind++;
+               break;
+         case 'B':
+               if ( globalUtilOptind >= argc )
+               {
+                   Abc_Print( -1, "Command line switch \"-B\" should be followed by an integer.\n" );
+                   return NULL;
+               }
+               opts.clause_max_sz_subsume = (unsigned)atoi(argv[globalUtilOptind]);
+               globalUtilOptind++;
+               break;
+         case 'X':
+               if ( globalUtilOptind >= argc )
+               {
+                   Abc_Print( -1, "Command line switch \"-X\" should be followed by an integer.\n" );
+                   return NULL;
+               }
+               opts.clause_max_lbd_vivify = (unsigned)atoi(argv[globalUtilOptind]);
+               globalUtilOptind++;
+               break;
 #ifdef SATOKO_ACT_VAR_FIXED
          case 'T':
                if ( globalUtilOptind >= argc )
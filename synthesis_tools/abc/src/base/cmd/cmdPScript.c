@@ -0,0 +1,671 @@
+/**CFile****************************************************************
+
+  FileName    [cmdPScript.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Command processing package.]
+
+  Synopsis    [Running alternative scripts concurrently and keeping the best result.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: cmdPScript.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "base/abc/abc.h"
+#include "base/main/mainInt.h"
+#include "map/if/if.h"
+#include "map/mio/mio.h"
+#include "map/scl/sclLib.h"
+#include "cmd.h"
+#include "cmdInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#include <fcntl.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+/*
+    Each script is applied to a private copy of the design state of the frame
+    (the current network, the GIA managers, the counter-examples and the 
+    verification status). The original state is taken out of the frame
+    while the scripts are running and is put back when they are done.
+    When ABC is compiled with pthreads, every script is run in its own
+    framework created by Abc_FrameCreate() in a worker thread. This gives 
+    the script its own copy of the libraries and of the per-thread data 
+    of the commands. The framework starts with the aliases and the variables 
+    of the main one and with the copies of its LUT, genlib and Liberty 
+    libraries. The resulting state of the best script is moved into the 
+    main framework, so the scripts are not re-run. Without pthreads, the 
+    scripts are run one at a time in the main framework.
+*/
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+typedef struct Cmd_PScrRes_t_ Cmd_PScrRes_t;
+struct Cmd_PScrRes_t_
+{
+    int        Status;      // 1 if the script succeeded
+    int        nNodes;      // the number of nodes (AND gates for AIGs)
+    int        nLevels;     // the number of logic levels
+    float      Delay;       // the delay (mapped networks) or the number of levels
+    float      Area;        // the area (mapped networks) or the number of nodes
+    abctime    Time;        // the runtime
+};
+
+typedef struct Cmd_PScrState_t_ Cmd_PScrState_t;
+struct Cmd_PScrState_t_
+{
+    Abc_Ntk_t *     pNtkCur;     // the current network (with its backups)
+    Gia_Man_t *     pGia;        // the current AIG and its copies
+    Gia_Man_t *     pGia2;
+    Gia_Man_t *     pGiaBest;
+    Gia_Man_t *     pGiaBest2;
+    Gia_Man_t *     pGiaSaved;
+    int             nBestLuts;   // the parameters of the best AIG
+    int             nBestEdges;
+    int             nBestLevels;
+    int             nBestLuts2;
+    int             nBestEdges2;
+    int             nBestLevels2;
+    Abc_Cex_t *     pCex;        // the counter-examples
+    Abc_Cex_t *     pCex2;
+    Vec_Ptr_t *     vCexVec;
+    Vec_Ptr_t *     vPoEquivs;   // equivalence classes of the outputs
+    Vec_Int_t *     vStatuses;   // the status of each output
+    int             Status;      // the status of the verification problem
+    int             nFrames;     // the number of frames completed by BMC
+};
+
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Cmd_PScrShare_t_ Cmd_PScrShare_t;
+struct Cmd_PScrShare_t_
+{
+    Abc_Frame_t *     pAbc;        // the main framework
+    Cmd_PScrState_t * pOrig;       // the original design state
+    Vec_Ptr_t *       vScripts;    // the scripts
+    Cmd_PScrRes_t *   pRes;        // the results of the scripts
+    Cmd_PScrState_t * pBest;       // the best resulting state
+    int               iBest;       // the index of the best script
+    int               iNext;       // the index of the next script to run
+    int               Metric;      // the quality metric
+    pthread_mutex_t   Mutex;       // protects the original state and the fields above
+};
+
+#endif
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the scripts from the file.]
+
+  Description [Each non-empty line, which does not start with '#',
+  is one script.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Ptr_t * Cmd_PScriptRead( char * pFileName )
+{
+    Vec_Ptr_t * vScripts;
+    FILE * pFile;
+    char * pBuffer, * pTemp;
+    int nSize = 10000;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        Abc_Print( -1, "Cannot open file \"%s\" with the scripts.\n", pFileName );
+        return NULL;
+    }
+    vScripts = Vec_PtrAlloc( 100 );
+    pBuffer = ABC_ALLOC( char, nSize );
+    while ( fgets( pBuffer, nSize, pFile ) )
+    {
+        // skip the leading spaces and remove the trailing ones
+        for ( pTemp = pBuffer; *pTemp == ' ' || *pTemp == '\t'; pTemp++ );
+        while ( *pTemp && strchr(" \t\r\n", pTemp[strlen(pTemp)-1]) )
+            pTemp[strlen(pTemp)-1] = 0;
+        if ( *pTemp == 0 || *pTemp == '#' )
+            continue;
+        Vec_PtrPush( vScripts, Abc_UtilStrsav(pTemp) );
+    }
+    ABC_FREE( pBuffer );
+    fclose( pFile );
+    return vScripts;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Measures the quality of the current network.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cmd_PScriptEvaluate( Abc_Frame_t * pAbc, Cmd_PScrRes_t * pRes )
+{
+    Abc_Ntk_t * pNtk = Abc_FrameReadNtk( pAbc );
+    if ( pNtk == NULL )
+        return;
+    pRes->Status  = 1;
+    pRes->nNodes  = Abc_NtkNodeNum( pNtk );
+    pRes->nLevels = Abc_NtkLevel( pNtk );
+    pRes->Delay   = (float)pRes->nLevels;
+    pRes->Area    = (float)pRes->nNodes;
+    if ( Abc_NtkHasMapping(pNtk) )
+    {
+        pRes->Delay = Abc_NtkDelayTrace( pNtk, NULL, NULL, 0 );
+        pRes->Area  = (float)Abc_NtkGetMappedArea( pNtk );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Compares the results.]
+
+  Description [Returns 1 if the first result is better.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cmd_PScriptCompare( Cmd_PScrRes_t * p1, Cmd_PScrRes_t * p2, int Metric )
+{
+    if ( p1->Status != p2->Status )
+        return p1->Status > p2->Status;
+    if ( Metric == 0 ) // nodes
+    {
+        if ( p1->Area != p2->Area )
+            return p1->Area < p2->Area;
+        return p1->Delay < p2->Delay;
+    }
+    if ( Metric == 1 && p1->nLevels != p2->nLevels ) // levels
+        return p1->nLevels < p2->nLevels;
+    // delay
+    if ( p1->Delay != p2->Delay )
+        return p1->Delay < p2->Delay;
+    return p1->Area < p2->Area;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Exchanges the design state of the frame and the given one.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cmd_PScriptStateSwap( Abc_Frame_t * pAbc, Cmd_PScrState_t * p )
+{
+    ABC_SWAP( Abc_Ntk_t *, pAbc->pNtkCur,      p->pNtkCur );
+    ABC_SWAP( Gia_Man_t *, pAbc->pGia,         p->pGia );
+    ABC_SWAP( Gia_Man_t *, pAbc->pGia2,        p->pGia2 );
+    ABC_SWAP( Gia_Man_t *, pAbc->pGiaBest,     p->pGiaBest );
+    ABC_SWAP( Gia_Man_t *, pAbc->pGiaBest2,    p->pGiaBest2 );
+    ABC_SWAP( Gia_Man_t *, pAbc->pGiaSaved,    p->pGiaSaved );
+    ABC_SWAP( int,         pAbc->nBestLuts,    p->nBestLuts );
+    ABC_SWAP( int,         pAbc->nBestEdges,   p->nBestEdges );
+    ABC_SWAP( int,         pAbc->nBestLevels,  p->nBestLevels );
+    ABC_SWAP( int,         pAbc->nBestLuts2,   p->nBestLuts2 );
+    ABC_SWAP( int,         pAbc->nBestEdges2,  p->nBestEdges2 );
+    ABC_SWAP( int,         pAbc->nBestLevels2, p->nBestLevels2 );
+    ABC_SWAP( Abc_Cex_t *, pAbc->pCex,         p->pCex );
+    ABC_SWAP( Abc_Cex_t *, pAbc->pCex2,        p->pCex2 );
+    ABC_SWAP( Vec_Ptr_t *, pAbc->vCexVec,      p->vCexVec );
+    ABC_SWAP( Vec_Ptr_t *, pAbc->vPoEquivs,    p->vPoEquivs );
+    ABC_SWAP( Vec_Int_t *, pAbc->vStatuses,    p->vStatuses );
+    ABC_SWAP( int,         pAbc->Status,       p->Status );
+    ABC_SWAP( int,         pAbc->nFrames,      p->nFrames );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Frees the design state.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cmd_PScriptStateFree( Cmd_PScrState_t * p )
+{
+    Abc_Ntk_t * pNtk, * pNtk2;
+    for ( pNtk = p->pNtkCur; pNtk; pNtk = pNtk2 )
+    {
+        pNtk2 = Abc_NtkBackup( pNtk );
+        Abc_NtkDelete( pNtk );
+    }
+    Gia_ManStopP( &p->pGia );
+    Gia_ManStopP( &p->pGia2 );
+    Gia_ManStopP( &p->pGiaBest );
+    Gia_ManStopP( &p->pGiaBest2 );
+    Gia_ManStopP( &p->pGiaSaved );
+    ABC_FREE( p->pCex );
+    ABC_FREE( p->pCex2 );
+    if ( p->vCexVec )   Vec_PtrFreeFree( p->vCexVec );
+    if ( p->vPoEquivs ) Vec_VecFree( (Vec_Vec_t *)p->vPoEquivs );
+    if ( p->vStatuses ) Vec_IntFree( p->vStatuses );
+    memset( p, 0, sizeof(Cmd_PScrState_t) );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Copies the original state into the frame.]
+
+  Description [The design state of the frame should be empty. The frame 
+  gets the copies of the current network and the current AIG of the 
+  original state.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cmd_PScriptCopy( Abc_Frame_t * pAbc, Cmd_PScrState_t * pOrig )
+{
+    assert( pAbc->pNtkCur == NULL && pAbc->pGia == NULL );
+    Abc_FrameReplaceCurrentNetwork( pAbc, Abc_NtkDup(pOrig->pNtkCur) );
+    if ( pOrig->pGia )
+    {
+        pAbc->pGia = Gia_ManDupWithAttributes( pOrig->pGia );
+        if ( pOrig->pGia->vNamesIn )
+            pAbc->pGia->vNamesIn = Vec_PtrDupStr( pOrig->pGia->vNamesIn );
+        if ( pOrig->pGia->vNamesOut )
+            pAbc->pGia->vNamesOut = Vec_PtrDupStr( pOrig->pGia->vNamesOut );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Applies the script to the design state of the frame.]
+
+  Description [When the script is done, the resulting state is moved 
+  into pResult and the frame is empty again.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cmd_PScriptRun( Abc_Frame_t * pAbc, char * pScript, Cmd_PScrRes_t * pRes, Cmd_PScrState_t * pResult )
+{
+    abctime clk = Abc_Clock();
+    memset( pRes, 0, sizeof(Cmd_PScrRes_t) );
+    if ( Cmd_CommandExecute( pAbc, pScript ) == 0 )
+        Cmd_PScriptEvaluate( pAbc, pRes );
+    pRes->Time = Abc_Clock() - clk;
+    memset( pResult, 0, sizeof(Cmd_PScrState_t) );
+    Cmd_PScriptStateSwap( pAbc, pResult );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Puts the resulting state into the frame.]
+
+  Description [The original state should be in the frame. The resulting 
+  network replaces the current one, as if the script was applied to it, 
+  and the rest of the original state is replaced by the resulting one.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cmd_PScriptInstall( Abc_Frame_t * pAbc, Cmd_PScrState_t * pResult )
+{
+    Abc_Ntk_t * pNtk, * pNtk2, * pNtkRes = pResult->pNtkCur;
+    // detach the resulting network from the networks derived by the script
+    for ( pNtk = Abc_NtkBackup(pNtkRes); pNtk; pNtk = pNtk2 )
+    {
+        pNtk2 = Abc_NtkBackup( pNtk );
+        Abc_NtkDelete( pNtk );
+    }
+    Abc_NtkSetBackup( pNtkRes, NULL );
+    // exchange the rest of the state, then replace the network
+    Cmd_PScriptStateSwap( pAbc, pResult );
+    ABC_SWAP( Abc_Ntk_t *, pAbc->pNtkCur, pResult->pNtkCur );
+    Abc_FrameReplaceCurrentNetwork( pAbc, pNtkRes );
+    pResult->pNtkCur = NULL;
+    Cmd_PScriptStateFree( pResult );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Applies the scripts one at a time.]
+
+  Description [Used when ABC is compiled without pthreads. Keeps the 
+  best resulting state in pBest and returns its index.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cmd_PScriptRunSequential( Abc_Frame_t * pAbc, Cmd_PScrState_t * pOrig, Vec_Ptr_t * vScripts, Cmd_PScrRes_t * pRes, int Metric, Cmd_PScrState_t * pBest )
+{
+    Cmd_PScrState_t Result;
+    char * pScript;
+    int i, iBest = -1;
+    Vec_PtrForEachEntry( char *, vScripts, pScript, i )
+    {
+        Cmd_PScriptCopy( pAbc, pOrig );
+        Cmd_PScriptRun( pAbc, pScript, pRes + i, &Result );
+        if ( pRes[i].Status && (iBest == -1 || Cmd_PScriptCompare(pRes + i, pRes + iBest, Metric)) )
+        {
+            Cmd_PScriptStateFree( pBest );
+            *pBest = Result;
+            iBest = i;
+        }
+        else
+            Cmd_PScriptStateFree( &Result );
+    }
+    return iBest;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Prepares the framework created for a script.]
+
+  Description [Copies the aliases and the variables of the main framework
+  and duplicates its LUT, genlib (including the one used by amap) and 
+  Liberty libraries, so that the script
+  does not share any data with the scripts running in other threads.
+  The boxes and the timing constraints of the main framework are not 
+  copied. Should be called in the thread owning the new framework while
+  no other thread uses the main one.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cmd_PScriptFrameStart( Abc_Frame_t * pAbc, Abc_Frame_t * pNew )
+{
+    st__generator * gen;
+    Abc_Alias * pAlias;
+    const char * pKey;
+    char * pValue;
+    st__foreach_item( pAbc->tAliases, gen, &pKey, (char **)&pAlias )
+        if ( !st__is_member(pNew->tAliases, pKey) )
+            CmdCommandAliasAdd( pNew, pAlias->sName, pAlias->argc, pAlias->argv );
+    st__foreach_item( pAbc->tFlags, gen, &pKey, &pValue )
+        if ( !st__is_member(pNew->tFlags, pKey) )
+            st__insert( pNew->tFlags, Extra_UtilStrsav(pKey), Extra_UtilStrsav(pValue) );
+    if ( pAbc->pLibLut )
+    {
+        If_LibLutFree( (If_LibLut_t *)pNew->pLibLut );
+        pNew->pLibLut = If_LibLutDup( (If_LibLut_t *)pAbc->pLibLut );
+    }
+    assert( pNew->pLibGen == NULL && pNew->pLibGen2 == NULL && pNew->pLibScl == NULL );
+    if ( pAbc->pLibGen )
+        pNew->pLibGen = Mio_LibraryDup( (Mio_Library_t *)pAbc->pLibGen, pAbc->pLibGen2 ? &pNew->pLibGen2 : NULL );
+    if ( pAbc->pLibScl )
+        pNew->pLibScl = Abc_SclLibDup( (SC_Lib *)pAbc->pLibScl );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Moves the resulting network to the libraries of the main frame.]
+
+  Description [A network mapped by the script uses the gates of the genlib 
+  library of its framework, which is freed together with the framework. 
+  These gates are replaced by the gates with the same names in the library
+  of the main framework. Returns 0 if this is not possible.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cmd_PScriptRebind( Abc_Frame_t * pAbc, Abc_Frame_t * pNew, Cmd_PScrState_t * pResult )
+{
+    Abc_Ntk_t * pNtk = pResult->pNtkCur;
+    Mio_Gate_t * pGate;
+    Abc_Obj_t * pObj;
+    int i;
+    if ( pNtk == NULL || !Abc_NtkHasMapping(pNtk) )
+        return 1;
+    if ( pNtk->pManFunc != pNew->pLibGen || pAbc->pLibGen == NULL )
+        return 0;
+    Abc_NtkForEachNode( pNtk, pObj, i )
+    {
+        pGate = (Mio_Gate_t *)pObj->pData;
+        pObj->pData = Mio_LibraryReadGateByName( (Mio_Library_t *)pAbc->pLibGen, Mio_GateReadName(pGate), Mio_GateReadOutName(pGate) );
+        if ( pObj->pData == NULL )
+            return 0;
+    }
+    pNtk->pManFunc = pAbc->pLibGen;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the scripts taken from the shared data.]
+
+  Description [Each script is run in a new framework, which is destroyed
+  when the script is done. The original state is copied, and the best 
+  result is updated, while holding the mutex.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Cmd_PScriptThread( void * pArg )
+{
+    Cmd_PScrShare_t * p = (Cmd_PScrShare_t *)pArg;
+    Cmd_PScrState_t Result;
+    Abc_Frame_t * pNew;
+    int i;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &p->Mutex );
+        i = p->iNext++;
+        pthread_mutex_unlock( &p->Mutex );
+        if ( i >= Vec_PtrSize(p->vScripts) )
+            break;
+        pNew = Abc_FrameCreate();
+        assert( pNew != NULL );
+        pthread_mutex_lock( &p->Mutex );
+        Cmd_PScriptFrameStart( p->pAbc, pNew );
+        Cmd_PScriptCopy( pNew, p->pOrig );
+        pthread_mutex_unlock( &p->Mutex );
+        Cmd_PScriptRun( pNew, (char *)Vec_PtrEntry(p->vScripts, i), p->pRes + i, &Result );
+        pthread_mutex_lock( &p->Mutex );
+        if ( !Cmd_PScriptRebind( p->pAbc, pNew, &Result ) )
+            p->pRes[i].Status = 0;
+        pthread_mutex_unlock( &p->Mutex );
+        pNew->fManDsdCache = 0;
+        Abc_FrameDestroy( pNew );
+        // keep the better result; the lower index wins a tie
+        pthread_mutex_lock( &p->Mutex );
+        if ( p->pRes[i].Status && (p->iBest == -1 || Cmd_PScriptCompare(p->pRes + i, p->pRes + p->iBest, p->Metric) || 
+             (i < p->iBest && !Cmd_PScriptCompare(p->pRes + p->iBest, p->pRes + i, p->Metric))) )
+        {
+            ABC_SWAP( Cmd_PScrState_t, *p->pBest, Result );
+            p->iBest = i;
+        }
+        pthread_mutex_unlock( &p->Mutex );
+        Cmd_PScriptStateFree( &Result );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Applies the scripts in the worker threads.]
+
+  Description [Starts at most nProcs threads. Keeps the best resulting 
+  state in pBest and returns its index. Unless fVerbose is set, the output
+  of the scripts is discarded.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cmd_PScriptRunParallel( Abc_Frame_t * pAbc, Cmd_PScrState_t * pOrig, Vec_Ptr_t * vScripts, Cmd_PScrRes_t * pRes, int nProcs, int Metric, int fVerbose, Cmd_PScrState_t * pBest )
+{
+    Cmd_PScrShare_t Share, * p = &Share;
+    pthread_t * pThreads;
+    int i, status, nThreads = Abc_MinInt( nProcs, Vec_PtrSize(vScripts) );
+#ifndef _WIN32
+    int fdOut = -1;
+#endif
+    memset( p, 0, sizeof(Cmd_PScrShare_t) );
+    p->pAbc     = pAbc;
+    p->pOrig    = pOrig;
+    p->vScripts = vScripts;
+    p->pRes     = pRes;
+    p->pBest    = pBest;
+    p->iBest    = -1;
+    p->Metric   = Metric;
+    status = pthread_mutex_init( &p->Mutex, NULL );  assert( status == 0 );
+#ifndef _WIN32
+    if ( !fVerbose )
+    {
+        int fd = open( "/dev/null", O_WRONLY );
+        fflush( stdout );
+        if ( fd >= 0 )
+        {
+            fdOut = dup( 1 );
+            dup2( fd, 1 );
+            close( fd );
+        }
+    }
+#endif
+    pThreads = ABC_ALLOC( pthread_t, nThreads );
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_create( pThreads + i, NULL, Cmd_PScriptThread, (void *)p );  assert( status == 0 );
+    }
+    for ( i = 0; i < nThreads; i++ )
+    {
+        status = pthread_join( pThreads[i], NULL );  assert( status == 0 );
+    }
+    ABC_FREE( pThreads );
+#ifndef _WIN32
+    if ( fdOut >= 0 )
+    {
+        fflush( stdout );
+        dup2( fdOut, 1 );
+        close( fdOut );
+    }
+#endif
+    pthread_mutex_destroy( &p->Mutex );
+    return p->iBest;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Runs the scripts and keeps the best result.]
+
+  Description [Metric is 0 (nodes), 1 (levels), or 2 (delay after mapping).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cmd_RunPScript( Abc_Frame_t * pAbc, char * pFileName, int nProcs, int Metric, int fVerbose )
+{
+    Vec_Ptr_t * vScripts;
+    Cmd_PScrState_t Orig, Best;
+    Cmd_PScrRes_t * pRes;
+    char * pScript;
+    int i, iBest = -1, RetValue = 0;
+    if ( Abc_FrameReadNtk(pAbc) == NULL )
+    {
+        Abc_Print( -1, "Empty network.\n" );
+        return 0;
+    }
+    vScripts = Cmd_PScriptRead( pFileName );
+    if ( vScripts == NULL )
+        return 0;
+    if ( Vec_PtrSize(vScripts) == 0 )
+    {
+        Abc_Print( -1, "File \"%s\" does not contain scripts.\n", pFileName );
+        Vec_PtrFree( vScripts );
+        return 0;
+    }
+    pRes = ABC_CALLOC( Cmd_PScrRes_t, Vec_PtrSize(vScripts) );
+    // take the original state out of the frame
+    memset( &Orig, 0, sizeof(Cmd_PScrState_t) );
+    memset( &Best, 0, sizeof(Cmd_PScrState_t) );
+    Cmd_PScriptStateSwap( pAbc, &Orig );
+#ifdef ABC_USE_PTHREADS
+    iBest = Cmd_PScriptRunParallel( pAbc, &Orig, vScripts, pRes, Abc_MaxInt(nProcs, 1), Metric, fVerbose, &Best );
+#else
+    iBest = Cmd_PScriptRunSequential( pAbc, &Orig, vScripts, pRes, Metric, &Best );
+#endif
+    if ( fVerbose )
+    {
+        Vec_PtrForEachEntry( char *, vScripts, pScript, i )
+        {
+            if ( pRes[i].Status )
+                printf( "Script %3d :  Nodes = %7d.  Levels = %4d.  Area = %10.2f.  Delay = %8.2f.  ",
+                    i, pRes[i].nNodes, pRes[i].nLevels, pRes[i].Area, pRes[i].Delay );
+            else
+                printf( "Script %3d :  Failed.%66s", i, "" );
+            Abc_PrintTime( 1, "Time", pRes[i].Time );
+        }
+    }
+    if ( iBest == -1 )
+        Abc_Print( -1, "None of the scripts succeeded.\n" );
+    // put the original state back and replace it by the best result
+    Cmd_PScriptStateSwap( pAbc, &Orig );
+    if ( iBest >= 0 )
+    {
+        Cmd_PScriptInstall( pAbc, &Best );
+        if ( fVerbose )
+            printf( "The best of %d scripts is %d: \"%s\".\n", Vec_PtrSize(vScripts), iBest, (char *)Vec_PtrEntry(vScripts, iBest) );
+        RetValue = 1;
+    }
+    Vec_PtrFreeFree( vScripts );
+    ABC_FREE( pRes );
+    return RetValue;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
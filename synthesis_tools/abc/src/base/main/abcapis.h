@@ -69,6 +69,11 @@ extern ABC_DLL void   Abc_Stop();
 extern ABC_DLL Abc_Frame_t * Abc_FrameGetGlobalFrame();
 extern ABC_DLL int   Cmd_CommandExecute( Abc_Frame_t * pAbc, const char * pCommandLine );
 
+// procedures to create, use, and destroy a framework owned by the calling thread
+extern ABC_DLL Abc_Frame_t * Abc_FrameCreate();
+extern ABC_DLL int   Abc_FrameRunScript( Abc_Frame_t * pAbc, const char * pScript );
+extern ABC_DLL void  Abc_FrameDestroy( Abc_Frame_t * pAbc );
+
 // procedures to input/output 'mini AIG'
 extern ABC_DLL void   Abc_NtkInputMiniAig( Abc_Frame_t * pAbc, void * pMiniAig );
 extern ABC_DLL void * Abc_NtkOutputMiniAig( Abc_Frame_t * pAbc );
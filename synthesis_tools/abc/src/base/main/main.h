@@ -69,6 +69,9 @@ ABC_NAMESPACE_HEADER_START
 /*=== main.c ===========================================================*/
 extern ABC_DLL void            Abc_Start();
 extern ABC_DLL void            Abc_Stop();
+extern ABC_DLL Abc_Frame_t *   Abc_FrameCreate();
+extern ABC_DLL int             Abc_FrameRunScript( Abc_Frame_t * pAbc, const char * pScript );
+extern ABC_DLL void            Abc_FrameDestroy( Abc_Frame_t * pAbc );
 
 /*=== mainFrame.c ===========================================================*/
 extern ABC_DLL Abc_Ntk_t *     Abc_FrameReadNtk( Abc_Frame_t * p );
@@ -89,6 +89,7 @@ struct Abc_Frame_t_
     void *          pManDec;       // decomposition manager
     void *          pManDsd;       // decomposition manager
     void *          pManDsd2;      // decomposition manager
+    int             fManDsdCache;  // the DSD manager can be written into "dsd_cache"
     // libraries for mapping
     void *          pLibLut;       // the current LUT library
     void *          pLibBox;       // the current box library
@@ -83,6 +83,72 @@ void Abc_Stop()
     Abc_FrameDeallocate( pAbc );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Creates a new ABC framework for the calling thread.]
+
+  Description [The global data of ABC (the framework, the command-line
+  parser state, and the precomputed libraries) is thread-local. Each
+  thread that needs to run ABC independently creates its own framework
+  using this procedure and later destroys it using Abc_FrameDestroy().
+  The framework is bound to the thread that created it and should only
+  be used by this thread. Returns NULL if the thread already has one.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Abc_Frame_t * Abc_FrameCreate()
+{
+    if ( Abc_FrameReadGlobalFrame() != NULL )
+        return NULL;
+    return Abc_FrameGetGlobalFrame();
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Executes a script in the framework of the calling thread.]
+
+  Description [The script is a sequence of commands separated by
+  semicolons, for example "read file.aig; strash; rw; write out.aig".
+  Returns 0 on success and a non-zero value if one of the commands failed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_FrameRunScript( Abc_Frame_t * pAbc, const char * pScript )
+{
+    if ( pAbc == NULL || pAbc != Abc_FrameReadGlobalFrame() )
+    {
+        printf( "Abc_FrameRunScript(): The framework does not belong to the calling thread.\n" );
+        return 1;
+    }
+    return Cmd_CommandExecute( pAbc, pScript );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Destroys the framework created by Abc_FrameCreate().]
+
+  Description [Should be called by the same thread that created it.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_FrameDestroy( Abc_Frame_t * pAbc )
+{
+    if ( pAbc == NULL )
+        return;
+    assert( pAbc == Abc_FrameReadGlobalFrame() );
+    Abc_FrameEnd( pAbc );
+    Abc_FrameDeallocate( pAbc );
+}
+
 
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
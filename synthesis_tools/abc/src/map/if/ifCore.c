@@ -51,6 +51,7 @@ void If_ManSetDefaultPars( If_Par_t * pPars )
     pPars->nCutsMax    =  8;
     pPars->nFlowIters  =  1;
     pPars->nAreaIters  =  2;
+    pPars->nProcs      =  0;
     pPars->DelayTarget = -1;
     pPars->Epsilon     =  (float)0.005;
     pPars->fPreprocess =  1;
@@ -82,8 +83,11 @@ int If_ManPerformMapping( If_Man_t * p )
     p->pPars->fAreaOnly = p->pPars->fArea; // temporary
     // create the CI cutsets
     If_ManSetupCiCutSets( p );
-    // allocate memory for other cutsets
-    If_ManSetupSetAll( p, If_ManCrossCut(p) );
+    // allocate memory for other cutsets (the level-by-level order may need more)
+    if ( If_ManPerformMappingParCheck(p) )
+        If_ManSetupSetAll( p, Abc_MaxInt(If_ManCrossCut(p), If_ManCrossCutLevel(p)) );
+    else
+        If_ManSetupSetAll( p, If_ManCrossCut(p) );
     // derive reverse top order
     p->vObjsRev = If_ManReverseOrder( p );
     return If_ManPerformMappingComb( p );
@@ -131,22 +131,42 @@ static inline int If_CutCheckDominance( If_Cut_t * pDom, If_Cut_t * pCut )
     // every node in pDom is contained in pCut
     return 1;
 }
+static inline int If_CutCheckDominanceOrdered( If_Cut_t * pDom, If_Cut_t * pCut )
+{
+    int * pD = pDom->pLeaves, * pDStop = pD + pDom->nLeaves;
+    int * pC = pCut->pLeaves, * pCStop = pC + pCut->nLeaves;
+    assert( pDom->nLeaves <= pCut->nLeaves );
+    // both leaf arrays are sorted; merge them in one pass
+    while ( pD < pDStop )
+    {
+        if ( pCStop - pC < pDStop - pD )
+            return 0;
+        if ( *pC < *pD )
+            pC++;
+        else if ( *pC == *pD )
+            pC++, pD++;
+        else // node *pD in pDom is not contained in pCut
+            return 0;
+    }
+    return 1;
+}
 
 /**Function*************************************************************
 
   Synopsis    [Returns 1 if the cut is contained.]
 
-  Description []
+  Description [If fOrdered is set, the leaves of all cuts are sorted,
+  which allows for a linear-time containment check.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-int If_CutFilter( If_Set_t * pCutSet, If_Cut_t * pCut, int fSaveCut0 )
+int If_CutFilter( If_Set_t * pCutSet, If_Cut_t * pCut, int fSaveCut0, int fOrdered )
 { 
     If_Cut_t * pTemp;
-    int i, k;
+    int i;
     assert( pCutSet->ppCuts[pCutSet->nCuts] == pCut );
     for ( i = 0; i < pCutSet->nCuts; i++ )
     {
@@ -160,15 +180,14 @@ int If_CutFilter( If_Set_t * pCutSet, If_Cut_t * pCut, int fSaveCut0 )
             if ( (pTemp->uSign & pCut->uSign) != pCut->uSign )
                 continue;
             // check containment seriously
-            if ( If_CutCheckDominance( pCut, pTemp ) )
+            if ( fOrdered ? If_CutCheckDominanceOrdered( pCut, pTemp ) : If_CutCheckDominance( pCut, pTemp ) )
             {
 //                p->ppCuts[i] = p->ppCuts[p->nCuts-1];
 //                p->ppCuts[p->nCuts-1] = pTemp;
 //                p->nCuts--;
 //                i--;
-                // remove contained cut
-                for ( k = i; k < pCutSet->nCuts; k++ )
-                    pCutSet->ppCuts[k] = pCutSet->ppCuts[k+1];
+                // remove contained cut (keep the remaining cuts sorted)
+                memmove( pCutSet->ppCuts + i, pCutSet->ppCuts + i + 1, sizeof(If_Cut_t *) * (pCutSet->nCuts - i) );
                 pCutSet->ppCuts[pCutSet->nCuts] = pTemp;
                 pCutSet->nCuts--;
                 i--;
@@ -180,7 +199,7 @@ int If_CutFilter( If_Set_t * pCutSet, If_Cut_t * pCut, int fSaveCut0 )
             if ( (pTemp->uSign & pCut->uSign) != pTemp->uSign )
                 continue;
             // check containment seriously
-            if ( If_CutCheckDominance( pTemp, pCut ) )
+            if ( fOrdered ? If_CutCheckDominanceOrdered( pTemp, pCut ) : If_CutCheckDominance( pTemp, pCut ) )
                 return 1;
         }
     }
@@ -2194,8 +2194,8 @@ float If_CutDelayLutStruct( If_Man_t * p, If_Cut_t * pCut, char * pStr, float Wi
 //#define IF_TRY_NEW
 
 #ifdef IF_TRY_NEW
-static Vec_Mem_t * s_vTtMem = NULL;
-static Vec_Mem_t * s_vTtMem2 = NULL;
+static ABC_THREAD_LOCAL Vec_Mem_t * s_vTtMem = NULL;
+static ABC_THREAD_LOCAL Vec_Mem_t * s_vTtMem2 = NULL;
 int If_TtMemCutNum()  { return Vec_MemEntryNum(s_vTtMem); }
 int If_TtMemCutNum2() { return Vec_MemEntryNum(s_vTtMem2); }
 //        printf( "Unique TTs = %d.  Unique classes = %d.    ", If_TtMemCutNum(), If_TtMemCutNum2() );
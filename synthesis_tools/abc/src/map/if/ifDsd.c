@@ -48,7 +48,8 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
-#define DSD_VERSION "dsd1"
+#define DSD_VERSION "dsd2"
+#define DSD_VERSION_OLD "dsd1"
 
 // network types
 typedef enum { 
@@ -91,6 +92,9 @@ struct If_DsdMan_t_
     Vec_Mem_t *    vTtMem[IF_MAX_FUNC_LUTSIZE+1];  // truth table memory and hash table
     Vec_Ptr_t *    vTtDecs[IF_MAX_FUNC_LUTSIZE+1]; // truth table decompositions
     Vec_Wec_t *    vIsops[IF_MAX_FUNC_LUTSIZE+1];  // ISOP for each function
+    Vec_Mem_t *    vTtCache[IF_MAX_FUNC_LUTSIZE+1];      // truth tables of the decomposed cut functions
+    Vec_Int_t *    vTtCacheDsds[IF_MAX_FUNC_LUTSIZE+1];  // DSD literals of the cut functions
+    Vec_Str_t *    vTtCachePerms[IF_MAX_FUNC_LUTSIZE+1]; // permutations of the cut functions
     int *          pSched[IF_MAX_FUNC_LUTSIZE];    // grey code schedules
     int            nTtBits;        // the number of truth table bits
     int            nConfigWords;   // the number of words for config data per node
@@ -103,6 +107,8 @@ struct If_DsdMan_t_
     int            fNewAsUseless;  // set new as useless
     int            nUniqueHits;    // statistics
     int            nUniqueMisses;  // statistics
+    int            nCacheHits;     // statistics
+    int            nCacheMisses;   // statistics
     abctime        timeDsd;        // statistics
     abctime        timeCanon;      // statistics
     abctime        timeCheck;      // statistics
@@ -289,6 +295,10 @@ If_DsdMan_t * If_DsdManAlloc( int nVars, int LutSize )
         p->vTtMem[v] = Vec_MemAlloc( Abc_TtWordNum(v), 12 );
         Vec_MemHashAlloc( p->vTtMem[v], 10000 );
         p->vTtDecs[v] = Vec_PtrAlloc( 1000 );
+        p->vTtCache[v] = Vec_MemAlloc( Abc_TtWordNum(v), 12 );
+        Vec_MemHashAlloc( p->vTtCache[v], 10000 );
+        p->vTtCacheDsds[v] = Vec_IntAlloc( 1000 );
+        p->vTtCachePerms[v] = Vec_StrAlloc( 1000 * v );
     }
 /*
     p->pTtGia   = Gia_ManStart( nVars );
@@ -354,6 +364,10 @@ void If_DsdManFree( If_DsdMan_t * p, int fVerbose )
         Vec_VecFree( (Vec_Vec_t *)(p->vTtDecs[v]) );
         if ( p->vIsops[v] )
             Vec_WecFree( p->vIsops[v] );
+        Vec_MemHashFree( p->vTtCache[v] );
+        Vec_MemFree( p->vTtCache[v] );
+        Vec_IntFree( p->vTtCacheDsds[v] );
+        Vec_StrFree( p->vTtCachePerms[v] );
     }
     Vec_WrdFreeP( &p->vConfigs );
     Vec_IntFreeP( &p->vTemp1 );
@@ -753,6 +767,8 @@ void If_DsdManPrint( If_DsdMan_t * p, char * pFileName, int Number, int Support,
     fprintf( pFile, "Non-DSD AIG nodes          = %8d\n", Gia_ManAndNum(p->pTtGia) );
     fprintf( pFile, "Unique table misses        = %8d\n", p->nUniqueMisses );
     fprintf( pFile, "Unique table hits          = %8d\n", p->nUniqueHits );
+    fprintf( pFile, "Function cache misses      = %8d\n", p->nCacheMisses );
+    fprintf( pFile, "Function cache hits        = %8d\n", p->nCacheHits );
     fprintf( pFile, "Memory used for objects    = %8.2f MB.\n", 1.0*Mem_FlexReadMemUsage(p->pMem)/(1<<20) );
     fprintf( pFile, "Memory used for functions  = %8.2f MB.\n", 8.0*(MemSizeTTs+sizeof(int)*Vec_IntCap(&p->vTruths))/(1<<20) );
     fprintf( pFile, "Memory used for hash table = %8.2f MB.\n", 1.0*sizeof(int)*(p->nBins+Vec_IntCap(&p->vNexts))/(1<<20) );
@@ -1101,6 +1117,20 @@ void If_DsdManSave( If_DsdMan_t * p, char * pFileName )
     fwrite( &Num, 4, 1, pFile );
     if ( Num )
         fwrite( p->pCellStr, sizeof(char)*Num, 1, pFile );
+    // the cache of decomposed cut functions
+    for ( v = 3; v <= p->nVars; v++ )
+    {
+        int nBytes = sizeof(word)*Vec_MemEntrySize(p->vTtCache[v]);
+        Num = Vec_MemEntryNum(p->vTtCache[v]);
+        fwrite( &Num, 4, 1, pFile );
+        Vec_MemForEachEntry( p->vTtCache[v], pTruth, i )
+            fwrite( pTruth, nBytes, 1, pFile );
+        if ( Num )
+        {
+            fwrite( Vec_IntArray(p->vTtCacheDsds[v]), sizeof(int)*Num, 1, pFile );
+            fwrite( Vec_StrArray(p->vTtCachePerms[v]), sizeof(char)*Num*v, 1, pFile );
+        }
+    }
     fclose( pFile );
 }
 If_DsdMan_t * If_DsdManLoad( char * pFileName )
@@ -1111,7 +1141,7 @@ If_DsdMan_t * If_DsdManLoad( char * pFileName )
     char pBuffer[10];
     unsigned * pSpot;
     word * pTruth;
-    int i, v, Num, Num2, RetValue;
+    int i, v, Num, Num2, RetValue, fCache = 0;
     FILE * pFile = fopen( pFileName, "rb" );
     if ( pFile == NULL )
     {
@@ -1119,9 +1149,12 @@ If_DsdMan_t * If_DsdManLoad( char * pFileName )
         return NULL;
     }
     RetValue = fread( pBuffer, 4, 1, pFile );
-    if ( strncmp(pBuffer, DSD_VERSION, strlen(DSD_VERSION)) )
+    if ( !strncmp(pBuffer, DSD_VERSION, strlen(DSD_VERSION)) )
+        fCache = 1;
+    else if ( strncmp(pBuffer, DSD_VERSION_OLD, strlen(DSD_VERSION_OLD)) )
     {
         printf( "Unrecognized format of file \"%s\".\n", pFileName );
+        fclose( pFile );
         return NULL;
     }
     RetValue = fread( &Num, 4, 1, pFile );
@@ -1195,6 +1228,27 @@ If_DsdMan_t * If_DsdManLoad( char * pFileName )
         p->pCellStr = ABC_CALLOC( char, Num + 1 );
         RetValue = fread( p->pCellStr, sizeof(char)*Num, 1, pFile );
     }
+    // the cache of decomposed cut functions
+    pTruth = ABC_ALLOC( word, p->nWords );
+    for ( v = 3; fCache && v <= p->nVars; v++ )
+    {
+        int nBytes = sizeof(word)*Vec_MemEntrySize(p->vTtCache[v]);
+        RetValue = fread( &Num, 4, 1, pFile );
+        for ( i = 0; i < Num; i++ )
+        {
+            RetValue = fread( pTruth, nBytes, 1, pFile );
+            Vec_MemHashInsert( p->vTtCache[v], pTruth );
+        }
+        assert( Num == Vec_MemEntryNum(p->vTtCache[v]) );
+        Vec_IntFill( p->vTtCacheDsds[v], Num, 0 );
+        Vec_StrFill( p->vTtCachePerms[v], Num*v, 0 );
+        if ( Num )
+        {
+            RetValue = fread( Vec_IntArray(p->vTtCacheDsds[v]), sizeof(int)*Num, 1, pFile );
+            RetValue = fread( Vec_StrArray(p->vTtCachePerms[v]), sizeof(char)*Num*v, 1, pFile );
+        }
+    }
+    ABC_FREE( pTruth );
     fclose( pFile );
     return p;
 }
@@ -2064,10 +2118,24 @@ int If_DsdManCompute( If_DsdMan_t * p, word * pTruth, int nLeaves, unsigned char
 {
     word pCopy[DAU_MAX_WORD], * pRes;
     char pDsd[DAU_MAX_STR];
-    int iDsd, nSizeNonDec, nSupp = 0;
+    int iDsd, nSizeNonDec, nSupp = 0, * pSpot = NULL;
     int nWords = Abc_TtWordNum(nLeaves);
 //    abctime clk = 0;
     assert( nLeaves <= DAU_MAX_VAR );
+    // check the cache of decomposed functions
+    if ( nLeaves >= 3 && nLeaves <= p->nVars )
+    {
+        pSpot = Vec_MemHashLookup( p->vTtCache[nLeaves], pTruth );
+        if ( *pSpot != -1 )
+        {
+            p->nCacheHits++;
+            iDsd = Vec_IntEntry( p->vTtCacheDsds[nLeaves], *pSpot );
+            memcpy( pPerm, Vec_StrEntryP(p->vTtCachePerms[nLeaves], *pSpot * nLeaves), nLeaves );
+            If_DsdVecObjIncRef( &p->vObjs, Abc_Lit2Var(iDsd) );
+            return iDsd;
+        }
+        p->nCacheMisses++;
+    }
     Abc_TtCopy( pCopy, pTruth, nWords, 0 );
 //clk = Abc_Clock();
     nSizeNonDec = Dau_DsdDecompose( pCopy, nLeaves, 0, 1, pDsd );
@@ -2094,6 +2162,13 @@ int If_DsdManCompute( If_DsdMan_t * p, word * pTruth, int nLeaves, unsigned char
         If_DsdManPrintOne( stdout, p, Abc_Lit2Var(iDsd), pPerm, 1 );
         printf( "\n" );
     }
+    else if ( pSpot )
+    {
+        // record the verified result
+        Vec_MemHashInsert( p->vTtCache[nLeaves], pTruth );
+        Vec_IntPush( p->vTtCacheDsds[nLeaves], iDsd );
+        Vec_StrPushBuffer( p->vTtCachePerms[nLeaves], (char *)pPerm, nLeaves );
+    }
     If_DsdVecObjIncRef( &p->vObjs, Abc_Lit2Var(iDsd) );
     assert( If_DsdVecLitSuppSize(&p->vObjs, iDsd) == nLeaves );
     return iDsd;
@@ -21,6 +21,17 @@
 #include "if.h"
 #include "misc/extra/extra.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 ////////////////////////////////////////////////////////////////////////
@@ -31,6 +42,33 @@ extern char * Dau_DsdMerge( char * pDsd0i, int * pPerm0, char * pDsd1i, int * pP
 extern int    If_CutDelayRecCost3( If_Man_t* p, If_Cut_t* pCut, If_Obj_t * pObj );
 extern int    Abc_ExactDelayCost( word * pTruth, int nVars, int * pArrTimeProfile, char * pPerm, int * Cost, int AigLevel );
 
+#define IF_PAR_THR_MAX   100   // the max number of threads
+#define IF_PAR_CHUNK      16   // the number of nodes taken by a thread at a time
+#define IF_PAR_LEVEL_MIN 256   // the min number of nodes in a level to start threads
+
+#ifdef ABC_USE_PTHREADS
+
+typedef struct If_ParShare_t_ If_ParShare_t;
+struct If_ParShare_t_
+{
+    If_Man_t *       pMan;           // the mapping manager
+    Vec_Int_t *      vNodes;         // the nodes of the current level
+    int              Mode;           // the mapping mode
+    int              fPreprocess;    // the preprocessing round
+    int              fFirst;         // the first round
+    int              iNext;          // the next node to be processed
+    pthread_mutex_t  Mutex;          // protects iNext
+};
+
+typedef struct If_ParThData_t_ If_ParThData_t;
+struct If_ParThData_t_
+{
+    If_ParShare_t *  pShare;         // the shared data
+    int              nCutsMerged;    // the number of cuts merged by this thread
+};
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -93,13 +131,13 @@ int If_ManCutAigDelay( If_Man_t * p, If_Obj_t * pObj, If_Cut_t * pCut )
   SeeAlso     []
 
 ***********************************************************************/
-static inline int If_WordCountOnes( unsigned uWord )
+static inline int If_WordCountOnes( word uWord )
 {
-    uWord = (uWord & 0x55555555) + ((uWord>>1) & 0x55555555);
-    uWord = (uWord & 0x33333333) + ((uWord>>2) & 0x33333333);
-    uWord = (uWord & 0x0F0F0F0F) + ((uWord>>4) & 0x0F0F0F0F);
-    uWord = (uWord & 0x00FF00FF) + ((uWord>>8) & 0x00FF00FF);
-    return  (uWord & 0x0000FFFF) + (uWord>>16);
+#if defined(__GNUC__)
+    return __builtin_popcountll( uWord );
+#else
+    return Abc_TtCountOnes( uWord );
+#endif
 }
 
 /**Function*************************************************************
@@ -150,21 +188,25 @@ int * If_CutArrTimeProfile( If_Man_t * p, If_Cut_t * pCut )
 
 /**Function*************************************************************
 
-  Synopsis    [Finds the best cut for the given node.]
+  Synopsis    [Computes the cuts of the node and selects the best one.]
 
-  Description [Mapping modes: delay (0), area flow (1), area (2).]
+  Description [Mapping modes: delay (0), area flow (1), area (2).
+  Assumes that the cutset of the node is allocated and the best cut is
+  dereferenced. Returns the number of merged cuts. Only touches the node 
+  itself and reads its fanins, unless the features that share truth tables 
+  or user callbacks across the nodes are enabled.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
-void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+static int If_ObjPerformMappingAndInt( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
 {
-    If_Set_t * pCutSet;
+    If_Set_t * pCutSet = pObj->pCutSet;
     If_Cut_t * pCut0, * pCut1, * pCut;
     If_Cut_t * pCut0R, * pCut1R;
-    int fFunc0R, fFunc1R;
+    int fFunc0R, fFunc1R, nCutsMerged = 0;
     int i, k, v, iCutDsd, fChange;
     int fSave0 = p->pPars->fDelayOpt || p->pPars->fDelayOptLut || p->pPars->fDsdBalance || p->pPars->fUserRecLib || p->pPars->fUserSesLib || 
         p->pPars->fUseDsdTune || p->pPars->fUseCofVars || p->pPars->fUseAndVars || p->pPars->fUse34Spec || p->pPars->pLutStruct || p->pPars->pFuncCell2;
@@ -177,12 +219,6 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         pObj->EstRefs = (float)pObj->nRefs;
     else if ( Mode == 1 )
         pObj->EstRefs = (float)((2.0 * pObj->EstRefs + pObj->nRefs) / 3.0);
-    // deref the selected cut
-    if ( Mode && pObj->nRefs > 0 )
-        If_CutAreaDeref( p, If_ObjCutBest(pObj) );
-
-    // prepare the cutset
-    pCutSet = If_ManSetupNodeCutSet( p, pObj );
 
     // get the current assigned best cut
     pCut = If_ObjCutBest(pObj);
@@ -266,10 +302,9 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
         }
         if ( pObj->fSpec && pCut->nLeaves == (unsigned)p->pPars->nLutSize )
             continue;
-        p->nCutsMerged++;
-        p->nCutsTotal++;
+        nCutsMerged++;
         // check if this cut is contained in any of the available cuts
-        if ( !p->pPars->fSkipCutFilter && If_CutFilter( pCutSet, pCut, fSave0 ) )
+        if ( !p->pPars->fSkipCutFilter && If_CutFilter( pCutSet, pCut, fSave0, !p->pPars->fUseTtPerm ) )
             continue;
         // check if the cut is a special AND-gate cut
         pCut->fAndCut = fUseAndCut && pCut->nLeaves == 2 && pCut->pLeaves[0] == pObj->pFanin0->Id && pCut->pLeaves[1] == pObj->pFanin1->Id;
@@ -290,7 +325,7 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
                 fChange = If_CutComputeTruth( p, pCut, pCut0, pCut1, pObj->fCompl0, pObj->fCompl1 );
             if ( p->pPars->fVerbose )
                 p->timeCache[4] += Abc_Clock() - clk;
-            if ( !p->pPars->fSkipCutFilter && fChange && If_CutFilter( pCutSet, pCut, fSave0 ) )
+            if ( !p->pPars->fSkipCutFilter && fChange && If_CutFilter( pCutSet, pCut, fSave0, !p->pPars->fUseTtPerm ) )
                 continue;
             if ( p->pPars->fUseDsd )
             {
@@ -475,7 +510,45 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
 //        p->nBestCutSmall[0]++;
 //    else if ( If_ObjCutBest(pObj)->nLeaves == 1 )
 //        p->nBestCutSmall[1]++;
+    return nCutsMerged;
+}
 
+/**Function*************************************************************
+
+  Synopsis    [Prepares the node for cut computation.]
+
+  Description [Dereferences the best cut and allocates the cutset.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void If_ObjPerformMappingAndStart( If_Man_t * p, If_Obj_t * pObj, int Mode )
+{
+    // deref the selected cut
+    if ( Mode && pObj->nRefs > 0 )
+        If_CutAreaDeref( p, If_ObjCutBest(pObj) );
+    // prepare the cutset
+    If_ManSetupNodeCutSet( p, pObj );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finalizes the node after cut computation.]
+
+  Description [References the best cut and frees the cutsets that are 
+  no longer needed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline void If_ObjPerformMappingAndStop( If_Man_t * p, If_Obj_t * pObj, int Mode )
+{
+    If_Cut_t * pCut;
+    int i;
     // ref the selected cut
     if ( Mode && pObj->nRefs > 0 )
         If_CutAreaRef( p, If_ObjCutBest(pObj) );
@@ -489,6 +562,27 @@ void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPrep
     If_ManDerefNodeCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Finds the best cut for the given node.]
+
+  Description [Mapping modes: delay (0), area flow (1), area (2).]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ObjPerformMappingAnd( If_Man_t * p, If_Obj_t * pObj, int Mode, int fPreprocess, int fFirst )
+{
+    int nCutsMerged;
+    If_ObjPerformMappingAndStart( p, pObj, Mode );
+    nCutsMerged = If_ObjPerformMappingAndInt( p, pObj, Mode, fPreprocess, fFirst );
+    p->nCutsMerged += nCutsMerged;
+    p->nCutsTotal  += nCutsMerged;
+    If_ObjPerformMappingAndStop( p, pObj, Mode );
+}
+
 /**Function*************************************************************
 
   Synopsis    [Finds the best cut for the choice node.]
@@ -535,7 +629,7 @@ void If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fP
             // copy the cut into storage
             If_CutCopy( p, pCut, pCutTemp );
             // check if this cut is contained in any of the available cuts
-            if ( If_CutFilter( pCutSet, pCut, fSave0 ) )
+            if ( If_CutFilter( pCutSet, pCut, fSave0, !p->pPars->fUseTtPerm ) )
                 continue;
             // check if the cut satisfies the required times
 //            assert( pCut->Delay == If_CutDelay( p, pTemp, pCut ) );
@@ -573,6 +667,150 @@ void If_ObjPerformMappingChoice( If_Man_t * p, If_Obj_t * pObj, int Mode, int fP
     If_ManDerefChoiceCutSet( p, pObj );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the nodes of one level can be mapped concurrently.]
+
+  Description [The cut computation of a node reads the data of its fanins 
+  and writes the data of the node itself, with the exception of sequential 
+  mapping, choices, boxes, and the features that share truth tables, DSD 
+  managers, or user callbacks across the nodes. The exact area recovery 
+  (Mode 2) is not parallelized because the area of a cut depends on the 
+  reference counters left by the nodes processed before. When the number 
+  of threads is 0, the nodes are mapped one by one in the order of IDs, 
+  which may lead to a slightly different area than the level-by-level 
+  order used for any positive number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManPerformMappingParCheck( If_Man_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    return p->pPars->nProcs > 0 && p->pManTim == NULL && p->nChoices == 0 && !p->pPars->fLiftLeaves &&
+        !p->pPars->fTruth && !p->pPars->fUseTtPerm && p->pPars->pFuncCost == NULL &&
+        !p->pPars->fDelayOpt && !p->pPars->fDelayOptLut && !p->pPars->fDsdBalance && 
+        !p->pPars->fUserRecLib && !p->pPars->fUserSesLib && p->pPars->nGateSize == 0;
+#else
+    return 0;
+#endif
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the cuts of the nodes taken from the current level.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * If_ManPerformMappingParThread( void * pArg )
+{
+    If_ParThData_t * pThData = (If_ParThData_t *)pArg;
+    If_ParShare_t * pShare = pThData->pShare;
+    If_Man_t * p = pShare->pMan;
+    int i, iStart, iStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pShare->Mutex );
+        iStart = pShare->iNext;
+        pShare->iNext += IF_PAR_CHUNK;
+        pthread_mutex_unlock( &pShare->Mutex );
+        if ( iStart >= Vec_IntSize(pShare->vNodes) )
+            break;
+        iStop = Abc_MinInt( iStart + IF_PAR_CHUNK, Vec_IntSize(pShare->vNodes) );
+        for ( i = iStart; i < iStop; i++ )
+            pThData->nCutsMerged += If_ObjPerformMappingAndInt( p, If_ManObj(p, Vec_IntEntry(pShare->vNodes, i)), pShare->Mode, pShare->fPreprocess, pShare->fFirst );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one mapping pass over all nodes using several threads.]
+
+  Description [The nodes are processed level by level. For each level, 
+  the best cuts are dereferenced and the cutsets are allocated in the main 
+  thread, then the cuts of the nodes are computed concurrently, after which 
+  the best cuts are referenced and the cutsets of the fanins are recycled 
+  in the order of node IDs. Since the nodes of one level do not depend on 
+  each other, the result does not depend on the number of threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void If_ManPerformMappingRoundPar( If_Man_t * p, int Mode, int fPreprocess, int fFirst )
+{
+    pthread_t WorkerThread[IF_PAR_THR_MAX];
+    If_ParThData_t ThData[IF_PAR_THR_MAX];
+    If_ParShare_t Share, * pShare = &Share;
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vNodes;
+    int nProcs = Abc_MinInt( p->pPars->nProcs, IF_PAR_THR_MAX );
+    int i, k, Id, status;
+    assert( Mode < 2 );
+    memset( pShare, 0, sizeof(If_ParShare_t) );
+    pShare->pMan        = p;
+    pShare->Mode        = Mode;
+    pShare->fPreprocess = fPreprocess;
+    pShare->fFirst      = fFirst;
+    status = pthread_mutex_init( &pShare->Mutex, NULL );  assert( status == 0 );
+    vLevels = If_ManCollectLevels( p );
+    Vec_WecForEachLevel( vLevels, vNodes, i )
+    {
+        Vec_IntForEachEntry( vNodes, Id, k )
+            If_ObjPerformMappingAndStart( p, If_ManObj(p, Id), Mode );
+        if ( Vec_IntSize(vNodes) < IF_PAR_LEVEL_MIN )
+        {
+            Vec_IntForEachEntry( vNodes, Id, k )
+                p->nCutsMerged += If_ObjPerformMappingAndInt( p, If_ManObj(p, Id), Mode, fPreprocess, fFirst );
+        }
+        else
+        {
+            pShare->vNodes = vNodes;
+            pShare->iNext  = 0;
+            for ( k = 0; k < nProcs; k++ )
+            {
+                ThData[k].pShare = pShare;
+                ThData[k].nCutsMerged = 0;
+            }
+            // the main thread is used as the last worker
+            for ( k = 0; k < nProcs - 1; k++ )
+            {
+                status = pthread_create( WorkerThread + k, NULL, If_ManPerformMappingParThread, (void *)(ThData + k) );  
+                assert( status == 0 );
+            }
+            If_ManPerformMappingParThread( (void *)(ThData + nProcs - 1) );
+            for ( k = 0; k < nProcs - 1; k++ )
+            {
+                status = pthread_join( WorkerThread[k], NULL );  
+                assert( status == 0 );
+            }
+            for ( k = 0; k < nProcs; k++ )
+                p->nCutsMerged += ThData[k].nCutsMerged;
+        }
+        Vec_IntForEachEntry( vNodes, Id, k )
+            If_ObjPerformMappingAndStop( p, If_ManObj(p, Id), Mode );
+    }
+    Vec_WecFree( vLevels );
+    pthread_mutex_destroy( &pShare->Mutex );
+}
+
+#else
+
+void If_ManPerformMappingRoundPar( If_Man_t * p, int Mode, int fPreprocess, int fFirst ) {}
+
+#endif
+
 /**Function*************************************************************
 
   Synopsis    [Performs one mapping pass over all nodes.]
@@ -637,6 +875,12 @@ int If_ManPerformMappingRound( If_Man_t * p, int nCutsUsed, int Mode, int fPrepr
         }
 //        Tim_ManPrint( p->pManTim );
     }
+    else if ( Mode < 2 && If_ManPerformMappingParCheck(p) )
+    {
+        int nCutsMerged = p->nCutsMerged;
+        If_ManPerformMappingRoundPar( p, Mode, fPreprocess, fFirst );
+        p->nCutsTotal += p->nCutsMerged - nCutsMerged;
+    }
     else
     {
         pProgress = Extra_ProgressBarStart( stdout, If_ManObjNum(p) );
@@ -349,6 +349,74 @@ int If_ManCrossCut( If_Man_t * p )
     return nCutSizeMax;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Collects the internal nodes by level.]
+
+  Description [The nodes of each level are ordered by ID.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * If_ManCollectLevels( If_Man_t * p )
+{
+    Vec_Wec_t * vLevels;
+    If_Obj_t * pObj;
+    int i;
+    vLevels = Vec_WecStart( p->nLevelMax + 1 );
+    If_ManForEachNode( p, pObj, i )
+        Vec_WecPush( vLevels, pObj->Level, pObj->Id );
+    return vLevels;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes cross-cut of the circuit processed level by level.]
+
+  Description [Assumes that the cutsets of all nodes of a level are 
+  allocated before any of them is recycled.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int If_ManCrossCutLevel( If_Man_t * p )
+{
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vNodes;
+    If_Obj_t * pObj, * pFanin;
+    int i, k, Id, nCutSize = 0, nCutSizeMax = 0;
+    vLevels = If_ManCollectLevels( p );
+    Vec_WecForEachLevel( vLevels, vNodes, i )
+    {
+        // consider the nodes
+        nCutSize += Vec_IntSize(vNodes);
+        if ( nCutSizeMax < nCutSize )
+            nCutSizeMax = nCutSize;
+        Vec_IntForEachEntry( vNodes, Id, k )
+        {
+            pObj = If_ManObj( p, Id );
+            if ( pObj->nVisits == 0 )
+                nCutSize--;
+            // consider the fanins
+            pFanin = If_ObjFanin0(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+            pFanin = If_ObjFanin1(pObj);
+            if ( !If_ObjIsCi(pFanin) && --pFanin->nVisits == 0 )
+                nCutSize--;
+        }
+    }
+    Vec_WecFree( vLevels );
+    If_ManForEachObj( p, pObj, i )
+        pObj->nVisits = pObj->nVisitsCopy;
+    assert( nCutSize == 0 );
+    return nCutSizeMax;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Computes the reverse topological order of nodes.]
@@ -25,6 +25,7 @@
 #include "misc/util/utilNam.h"
 #include "map/scl/sclLib.h"
 #include "map/scl/sclCon.h"
+#include "map/amap/amap.h"
 
 ABC_NAMESPACE_IMPL_START
 
@@ -286,6 +287,55 @@ void Mio_WriteLibrary( FILE * pFile, Mio_Library_t * pLib, int fPrintSops, int f
     Vec_PtrFree( vGates );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the library.]
+
+  Description [Writes the library into a temporary file and reads it 
+  back. The cell IDs of the gates are transferred to the new library.
+  If ppLib2 is given, it also derives the library used by amap from the 
+  same text.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Mio_Library_t * Mio_LibraryDup( Mio_Library_t * pLib, void ** ppLib2 )
+{
+    Mio_Library_t * pLibNew = NULL;
+    Mio_Gate_t * pGate, * pGateNew;
+    FILE * pFile = tmpfile();
+    char * pBuffer;
+    int nSize;
+    if ( pFile == NULL )
+        return NULL;
+    Mio_WriteLibrary( pFile, pLib, 0, 0, 0 );
+    nSize = ftell( pFile );
+    rewind( pFile );
+    pBuffer = ABC_ALLOC( char, nSize + 10 );
+    if ( (int)fread( pBuffer, 1, nSize, pFile ) == nSize )
+    {
+        pBuffer[nSize] = 0;
+        strcat( pBuffer, "\n.end\n" );
+        if ( ppLib2 )
+        {
+            char * pBuffer2 = Abc_UtilStrsav( pBuffer );
+            *ppLib2 = Amap_LibReadAndPrepare( pLib->pName, pBuffer2, 0, 0 );
+            ABC_FREE( pBuffer2 );
+        }
+        pLibNew = Mio_LibraryRead( pLib->pName, pBuffer, NULL, 0 );
+    }
+    ABC_FREE( pBuffer );
+    fclose( pFile );
+    if ( pLibNew == NULL )
+        return NULL;
+    Mio_LibraryForEachGate( pLib, pGate )
+        if ( (pGateNew = Mio_LibraryReadGateByName(pLibNew, pGate->pName, pGate->pOutName)) )
+            pGateNew->Cell = pGate->Cell;
+    return pLibNew;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Compares the max delay of two gates.]
@@ -19,6 +19,7 @@
 ***********************************************************************/
 
 #include "aig/gia/gia.h"
+#include "misc/extra/extra.h"
 #include "mpmInt.h"
 
 ABC_NAMESPACE_IMPL_START
@@ -109,6 +110,141 @@ Mig_Man_t * Mig_ManCreate( void * pGia )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Adds majority node while detecting trivial cases.]
+
+  Description [Majority nodes with two equal or complementary fanins 
+  are replaced by the remaining fanin, while those with a constant 
+  fanin are converted into AND and OR nodes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Mig_ManAppendMajSimple( Mig_Man_t * p, int iLit0, int iLit1, int iLit2 )
+{
+    int Temp;
+    // sort the literals in the increasing order
+    if ( iLit0 > iLit1 ) Temp = iLit0, iLit0 = iLit1, iLit1 = Temp;
+    if ( iLit1 > iLit2 ) Temp = iLit1, iLit1 = iLit2, iLit2 = Temp;
+    if ( iLit0 > iLit1 ) Temp = iLit0, iLit0 = iLit1, iLit1 = Temp;
+    // equal or complementary literals are now next to each other
+    if ( iLit0 == iLit1 || iLit1 == iLit2 )
+        return iLit1;
+    if ( Abc_Lit2Var(iLit0) == Abc_Lit2Var(iLit1) )
+        return iLit2;
+    if ( Abc_Lit2Var(iLit1) == Abc_Lit2Var(iLit2) )
+        return iLit0;
+    // constant literals are the smallest
+    if ( iLit0 == 0 )
+        return Mig_ManAppendAnd( p, iLit1, iLit2 );
+    if ( iLit0 == 1 )
+        return Abc_LitNot( Mig_ManAppendAnd( p, Abc_LitNot(iLit1), Abc_LitNot(iLit2) ) );
+    return Mig_ManAppendMaj( p, iLit0, iLit1, iLit2 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads MIG from the binary file.]
+
+  Description [The file begins with the header line "mig M I O N", 
+  where I is the number of inputs, O is the number of outputs, N is 
+  the number of majority nodes, and M = I + N is the largest variable. 
+  Variable 0 is constant 0, the inputs are variables 1 to I, and the 
+  nodes are variables I+1 to M listed in the topological order. 
+  Similar to the binary AIGER format, the fanin literals of each node 
+  are sorted in the decreasing order and written as three differences 
+  (the node literal minus the first fanin literal, the first minus the 
+  second, and the second minus the third), followed by the output 
+  literals. All numbers use the 7-bit variable-length encoding.
+  The nodes are loaded into the manager as they are, without 
+  translating them into AIG nodes.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Mig_Man_t * Mig_ManReadMig( char * pFileName )
+{
+    Mig_Man_t * pNew;
+    Vec_Int_t * vCopies;
+    FILE * pFile;
+    unsigned char * pContents, * pCur, * pEnd;
+    unsigned uLit, uLit0, uLit1, uLit2, uDiff;
+    int i, nFileSize, nVars, nIns, nOuts, nNodes, RetValue;
+    pFile = fopen( pFileName, "rb" );
+    if ( pFile == NULL )
+    {
+        printf( "Cannot open input file \"%s\".\n", pFileName );
+        return NULL;
+    }
+    fseek( pFile, 0, SEEK_END );
+    nFileSize = ftell( pFile );
+    rewind( pFile );
+    // the trailing zero terminates the last number if the file is truncated
+    pContents = ABC_CALLOC( unsigned char, nFileSize + 1 );
+    RetValue = fread( pContents, nFileSize, 1, pFile );
+    fclose( pFile );
+    // read the header
+    pCur = (unsigned char *)strchr( (char *)pContents, '\n' );
+    if ( pCur == NULL || sscanf( (char *)pContents, "mig %d %d %d %d", &nVars, &nIns, &nOuts, &nNodes ) != 4 || 
+         nIns < 0 || nOuts < 0 || nNodes < 0 || nVars != nIns + nNodes )
+    {
+        printf( "Mig_ManReadMig(): The header of file \"%s\" is not valid.\n", pFileName );
+        ABC_FREE( pContents );
+        return NULL;
+    }
+    pCur++;
+    pEnd = pContents + nFileSize;
+    // create the manager
+    pNew = Mig_ManStart();
+    pNew->pName = Extra_FileNameGeneric( pFileName );
+    vCopies = Vec_IntAlloc( nVars + 1 );
+    Vec_IntPush( vCopies, 0 );
+    for ( i = 0; i < nIns; i++ )
+        Vec_IntPush( vCopies, Mig_ManAppendCi(pNew) );
+    for ( i = 0; i < nNodes; i++ )
+    {
+        uLit = 2 * (nIns + 1 + i);
+        if ( pCur >= pEnd || (uDiff = Gia_AigerReadUnsigned(&pCur)) == 0 || uDiff > uLit )
+            break;
+        uLit0 = uLit - uDiff;
+        if ( pCur >= pEnd || (uDiff = Gia_AigerReadUnsigned(&pCur)) > uLit0 )
+            break;
+        uLit1 = uLit0 - uDiff;
+        if ( pCur >= pEnd || (uDiff = Gia_AigerReadUnsigned(&pCur)) > uLit1 )
+            break;
+        uLit2 = uLit1 - uDiff;
+        Vec_IntPush( vCopies, Mig_ManAppendMajSimple( pNew, 
+            Abc_LitNotCond( Vec_IntEntry(vCopies, Abc_Lit2Var(uLit0)), Abc_LitIsCompl(uLit0) ), 
+            Abc_LitNotCond( Vec_IntEntry(vCopies, Abc_Lit2Var(uLit1)), Abc_LitIsCompl(uLit1) ), 
+            Abc_LitNotCond( Vec_IntEntry(vCopies, Abc_Lit2Var(uLit2)), Abc_LitIsCompl(uLit2) ) ) );
+    }
+    if ( i == nNodes )
+    {
+        for ( i = 0; i < nOuts; i++ )
+        {
+            if ( pCur >= pEnd || (uLit = Gia_AigerReadUnsigned(&pCur)) >= 2 * (unsigned)(nVars + 1) )
+                break;
+            Mig_ManAppendCo( pNew, Abc_LitNotCond( Vec_IntEntry(vCopies, Abc_Lit2Var(uLit)), Abc_LitIsCompl(uLit) ) );
+        }
+    }
+    RetValue = Vec_IntSize(vCopies) == nVars + 1 && Mig_ManCoNum(pNew) == nOuts && pCur <= pEnd;
+    Vec_IntFree( vCopies );
+    ABC_FREE( pContents );
+    if ( !RetValue )
+    {
+        printf( "Mig_ManReadMig(): The contents of file \"%s\" is not valid.\n", pFileName );
+        Mig_ManStop( pNew );
+        return NULL;
+    }
+    Mig_ManSetRegNum( pNew, 0 );
+    return pNew;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Recursively derives the local AIG for the cut.]
@@ -163,6 +299,8 @@ int Mpm_ManNodeIfToGia_rec( Gia_Man_t * pNew, Mpm_Man_t * pMan, Mig_Obj_t * pObj
         {
             if ( Mig_ObjIsMux(pTemp) )
                 iFunc = Gia_ManHashMux( pNew, iFunc2, iFunc1, iFunc0 );
+            else if ( Mig_ObjIsMaj(pTemp) )
+                iFunc = Gia_ManHashMaj( pNew, iFunc0, iFunc1, iFunc2 );
             else if ( Mig_ObjIsXor(pTemp) )
                 iFunc = Gia_ManHashXor( pNew, iFunc0, iFunc1 );
             else 
@@ -172,6 +310,8 @@ int Mpm_ManNodeIfToGia_rec( Gia_Man_t * pNew, Mpm_Man_t * pMan, Mig_Obj_t * pObj
         {
             if ( Mig_ObjIsMux(pTemp) )
                 iFunc = Gia_ManAppendMux( pNew, iFunc2, iFunc1, iFunc0 );
+            else if ( Mig_ObjIsMaj(pTemp) )
+                iFunc = Gia_ManAppendMaj( pNew, iFunc0, iFunc1, iFunc2 );
             else if ( Mig_ObjIsXor(pTemp) )
                 iFunc = Gia_ManAppendXor( pNew, iFunc0, iFunc1 );
             else 
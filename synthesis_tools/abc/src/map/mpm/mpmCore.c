@@ -106,6 +106,32 @@ Gia_Man_t * Mpm_ManLutMapping( Gia_Man_t * pGia, Mpm_Par_t * pPars )
     return pNew;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Performs LUT mapping of MIG read from the binary file.]
+
+  Description [The majority nodes are mapped directly, without 
+  being translated into AIG nodes first.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Gia_Man_t * Mpm_ManLutMappingMig( char * pFileName, Mpm_Par_t * pPars )
+{
+    Mig_Man_t * p;
+    Gia_Man_t * pNew;
+    assert( pPars->pLib->LutMax <= MPM_VAR_MAX );
+    assert( pPars->nNumCuts <= MPM_CUT_MAX );
+    p = Mig_ManReadMig( pFileName );
+    if ( p == NULL )
+        return NULL;
+    pNew = Mpm_ManPerformLutMapping( p, pPars );
+    Mig_ManStop( p );
+    return pNew;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -989,7 +989,11 @@ Kit_DsdPrintFromTruth( (unsigned *)&t, 6 );        printf( "\n" );
         t0 = (fCompl0 ^ pCut0->fCompl ^ Abc_LitIsCompl(pCut0->iFunc)) ? ~Truth0  : Truth0;
         t1 = (fCompl1 ^ pCut1->fCompl ^ Abc_LitIsCompl(pCut1->iFunc)) ? ~Truth1p : Truth1p;
         tC = (fComplC ^ pCutC->fCompl ^ Abc_LitIsCompl(pCutC->iFunc)) ? ~TruthCp : TruthCp;
-        t = (tC & t1) | (~tC & t0);
+        if ( Type == 3 )
+            t = (tC & t1) | (~tC & t0);
+        else if ( Type == 4 )
+            t = (t0 & t1) | (t0 & tC) | (t1 & tC);
+        else assert( 0 );
     }
 
     // find configuration
@@ -228,6 +228,7 @@ static inline void        Mpm_VarsSwap( int * V2P, int * P2V, int iVar, int jVar
 
 /*=== mpmAbc.c ===========================================================*/
 extern Mig_Man_t *           Mig_ManCreate( void * pGia );
+extern Mig_Man_t *           Mig_ManReadMig( char * pFileName );
 extern void *                Mpm_ManFromIfLogic( Mpm_Man_t * pMan );
 /*=== mpmMan.c ===========================================================*/
 extern Mpm_Man_t *           Mpm_ManStart( Mig_Man_t * pMig, Mpm_Par_t * pPars );
@@ -165,9 +165,9 @@ void Mpm_ManStop( Mpm_Man_t * p )
 ***********************************************************************/
 void Mpm_ManPrintStatsInit( Mpm_Man_t * p )
 {
-    printf( "K = %d.  C = %d.  Cand = %d. XOR = %d. MUX = %d. Choice = %d.  CutMin = %d. Truth = %d. DSD = %d.\n", 
+    printf( "K = %d.  C = %d.  Cand = %d. XOR = %d. MUX = %d. MAJ = %d. Choice = %d.  CutMin = %d. Truth = %d. DSD = %d.\n", 
         p->nLutSize, p->nNumCuts, Mig_ManCandNum(p->pMig), 
-        Mig_ManXorNum(p->pMig), Mig_ManMuxNum(p->pMig), p->pMig->nChoices, 
+        Mig_ManXorNum(p->pMig), Mig_ManMuxNum(p->pMig), Mig_ManMajNum(p->pMig), p->pMig->nChoices, 
         p->pPars->fCutMin, p->pPars->fUseTruth, p->pPars->fUseDsd );
 }
 void Mpm_ManPrintStats( Mpm_Man_t * p )
@@ -431,10 +431,10 @@ p->timeMerge += clock() - clk;
         if ( pCut == NULL )
             return 1;
         if ( p->pPars->fUseTruth )
-            Mpm_CutComputeTruth( p, pCut, pCut1, pCut0, pCut2, Mig_ObjFaninC1(pObj), Mig_ObjFaninC0(pObj), 1 ^ Mig_ObjFaninC2(pObj), Mig_ObjNodeType(pObj) ); 
+            Mpm_CutComputeTruth( p, pCut, pCut1, pCut0, pCut2, Mig_ObjFaninC1(pObj), Mig_ObjFaninC0(pObj), Mig_ObjIsMux(pObj) ^ Mig_ObjFaninC2(pObj), Mig_ObjNodeType(pObj) ); 
         else if ( p->pPars->fUseDsd )
         {
-            if ( !Mpm_CutComputeDsd6( p, pCut, pCut1, pCut0, pCut2, Mig_ObjFaninC1(pObj), Mig_ObjFaninC0(pObj), 1 ^ Mig_ObjFaninC2(pObj), Mig_ObjNodeType(pObj) ) )
+            if ( !Mpm_CutComputeDsd6( p, pCut, pCut1, pCut0, pCut2, Mig_ObjFaninC1(pObj), Mig_ObjFaninC0(pObj), Mig_ObjIsMux(pObj) ^ Mig_ObjFaninC2(pObj), Mig_ObjNodeType(pObj) ) )
                 return 1;
         }
     }
@@ -107,6 +107,10 @@ int Mig_ManMuxNum( Mig_Man_t * p )
 {
     return Mig_ManTypeNum(p, 3);
 }
+int Mig_ManMajNum( Mig_Man_t * p )
+{
+    return Mig_ManTypeNum(p, 4);
+}
 
 
 /**Function*************************************************************
@@ -139,9 +139,10 @@ static inline int          Mig_ObjIsNode2( Mig_Obj_t * p )                     {
 static inline int          Mig_ObjIsNode3( Mig_Obj_t * p )                     { return Mig_ObjIsNode( p ) && !Mig_FanIsNone( p, 2 );       } 
 static inline int          Mig_ObjIsAnd( Mig_Obj_t * p )                       { return Mig_ObjIsNode2( p ) && Mig_FanId(p, 0) < Mig_FanId(p, 1); } 
 static inline int          Mig_ObjIsXor( Mig_Obj_t * p )                       { return Mig_ObjIsNode2( p ) && Mig_FanId(p, 0) > Mig_FanId(p, 1); } 
-static inline int          Mig_ObjIsMux( Mig_Obj_t * p )                       { return Mig_ObjIsNode3( p );                                } 
+static inline int          Mig_ObjIsMux( Mig_Obj_t * p )                       { return Mig_ObjIsNode3( p ) && Mig_FanId(p, 0) <= Mig_FanId(p, 1); } 
+static inline int          Mig_ObjIsMaj( Mig_Obj_t * p )                       { return Mig_ObjIsNode3( p ) && Mig_FanId(p, 0) > Mig_FanId(p, 1); } 
 static inline int          Mig_ObjIsCand( Mig_Obj_t * p )                      { return Mig_ObjIsNode(p) || Mig_ObjIsCi(p);                 } 
-static inline int          Mig_ObjNodeType( Mig_Obj_t * p )                    { return Mig_ObjIsAnd(p) ? 1 : (Mig_ObjIsXor(p) ? 2 : 3);    } 
+static inline int          Mig_ObjNodeType( Mig_Obj_t * p )                    { return Mig_ObjIsAnd(p) ? 1 : (Mig_ObjIsXor(p) ? 2 : (Mig_ObjIsMaj(p) ? 4 : 3)); } 
 
 static inline int          Mig_ObjId( Mig_Obj_t * p )                          { return Mig_FanId( p, 3 );                                  }
 static inline void         Mig_ObjSetId( Mig_Obj_t * p, int v )                { Mig_FanSetId( p, 3, v );                                   }
@@ -290,6 +291,7 @@ static inline int Mig_ManAppendMaj( Mig_Man_t * p, int iLit0, int iLit1, int iLi
 { 
     Mig_Obj_t * pObj = Mig_ManAppendObj( p );
     assert( iLit0 != iLit1 && iLit0 != iLit2 && iLit1 != iLit2 );
+    assert( Abc_Lit2Var(iLit0) != Abc_Lit2Var(iLit1) );
     Mig_ObjSetFaninLit( pObj, 0, iLit0 < iLit1 ? iLit1 : iLit0 );
     Mig_ObjSetFaninLit( pObj, 1, iLit0 < iLit1 ? iLit0 : iLit1 );
     Mig_ObjSetFaninLit( pObj, 2, iLit2 );
@@ -347,6 +349,7 @@ extern void                  Mig_ManSetRefs( Mig_Man_t * p );
 extern int                   Mig_ManAndNum( Mig_Man_t * p );
 extern int                   Mig_ManXorNum( Mig_Man_t * p );
 extern int                   Mig_ManMuxNum( Mig_Man_t * p );
+extern int                   Mig_ManMajNum( Mig_Man_t * p );
 
 ABC_NAMESPACE_HEADER_END
 
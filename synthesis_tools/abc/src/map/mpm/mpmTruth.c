@@ -165,6 +165,8 @@ static inline int Mpm_CutComputeTruth6( Mpm_Man_t * p, Mpm_Cut_t * pCut, Mpm_Cut
         t = t0 ^ t1;
     else if ( Type == 3 )
         t = (tC & t1) | (~tC & t0);
+    else if ( Type == 4 )
+        t = (t0 & t1) | (t0 & tC) | (t1 & tC);
     else assert( 0 );
     // save the result
     if ( t & 1 )
@@ -199,6 +201,8 @@ static inline int Mpm_CutComputeTruth7( Mpm_Man_t * p, Mpm_Cut_t * pCut, Mpm_Cut
         Abc_TtXor( p->Truth, p->Truth0, p->Truth1, p->nTruWords, 0 );
     else if ( Type == 3 )
         Abc_TtMux( p->Truth, p->TruthC, p->Truth1, p->Truth0, p->nTruWords );
+    else if ( Type == 4 )
+        Abc_TtMaj( p->Truth, p->Truth0, p->Truth1, p->TruthC, p->nTruWords );
     else assert( 0 );
     // save the result
     if ( p->Truth[0] & 1 )
@@ -85,6 +85,7 @@ struct SC_SizePars_
     int        TimeOut;
     int        BuffTreeEst;      // ratio for buffer tree estimation
     int        BypassFreq;       // frequency to try bypassing
+    int        nProcs;           // the number of threads for full timing
     int        fUseDept;
     int        fDumpStats;
     int        fUseWireLoads;
@@ -154,6 +155,9 @@ struct SC_Surface_
     Vec_Int_t      vIndex1I;       // Vec<float>       -- correspondes to "index_2" in the liberty file (for timing: load)
     Vec_Ptr_t      vDataI;         // Vec<Vec<float> > -- 'data[i0][i1]' gives value at '(index0[i0], index1[i1])' 
     float          approx[3][6];
+    int            nTable0;        // the number of slew points in the lookup table
+    int            nTable1;        // the number of load points in the lookup table
+    float *        pTable;         // lookup table: slew points, inverse slew steps, load points, inverse load steps, data
 };
 
 struct SC_Timing_ 
@@ -165,6 +169,7 @@ struct SC_Timing_
     SC_Surface     pCellFall;
     SC_Surface     pRiseTrans;     // -- Used to compute output slew
     SC_Surface     pFallTrans;
+    int            fSameIndex;     // -- delay and slew surfaces have the same indexes
 };
 
 struct SC_Timings_ 
@@ -391,6 +396,7 @@ static inline void Abc_SclSurfaceFree( SC_Surface * p )
     Vec_IntErase( &p->vIndex1I );
     Vec_VecErase( (Vec_Vec_t *)&p->vData );
     Vec_VecErase( (Vec_Vec_t *)&p->vDataI );
+    ABC_FREE( p->pTable );
     ABC_FREE( p->pName );
 //    ABC_FREE( p );
 }
@@ -469,68 +475,88 @@ static inline void Abc_SclLibFree( SC_Lib * p )
 
   Synopsis    [Lookup table delay computation.]
 
-  Description []
+  Description [Uses the lookup table derived by Abc_SclLibPrepareTables().
+  Each dimension of the table has at least two points, the inverse steps 
+  between the points are precomputed, and the data is stored row by row 
+  after the indexes. The segment is found without branches by counting 
+  the inner points not exceeding the value, which is equivalent to the 
+  linear search, because the points are sorted.]
                
   SideEffects []
 
   SeeAlso     []
 
 ***********************************************************************/
+static inline int Scl_LibLookupSegment( float * pIndex, int nIndex, float Value )
+{
+    int k, s = 0;
+    for ( k = 1; k < nIndex - 1; k++ )
+        s += (pIndex[k] <= Value);
+    return s;
+}
+static inline float Scl_LibLookupInterpolate( float * pData, int nTable1, int s, int l, float sfrac, float lfrac )
+{
+    float * pDataS  = pData + s * nTable1;
+    float * pDataS1 = pDataS + nTable1;
+    float p0 = pDataS [l] + lfrac * (pDataS [l+1] - pDataS [l]);
+    float p1 = pDataS1[l] + lfrac * (pDataS1[l+1] - pDataS1[l]);
+    return p0 + sfrac * (p1 - p0);      // <<== multiply result with K factor here 
+}
 static inline float Scl_LibLookup( SC_Surface * p, float slew, float load )
 {
-    float * pIndex0, * pIndex1, * pDataS, * pDataS1;
-    float sfrac, lfrac, p0, p1;
+    float * pIndex0, * pIndex1, sfrac, lfrac;
     int s, l;
-
-    // handle constant table
-    if ( Vec_FltSize(&p->vIndex0) == 1 && Vec_FltSize(&p->vIndex1) == 1 )
+    assert( p->pTable != NULL );
+    // find closest sample points in surface
+    pIndex0 = p->pTable;
+    pIndex1 = pIndex0 + 2 * p->nTable0;
+    s = Scl_LibLookupSegment( pIndex0, p->nTable0, slew );
+    l = Scl_LibLookupSegment( pIndex1, p->nTable1, load );
+    // interpolate (or extrapolate) function value from sample points
+    sfrac = (slew - pIndex0[s]) * pIndex0[p->nTable0 + s];
+    lfrac = (load - pIndex1[l]) * pIndex1[p->nTable1 + l];
+    return Scl_LibLookupInterpolate( pIndex1 + 2 * p->nTable1, p->nTable1, s, l, sfrac, lfrac );
+}
+// looks up the delay and slew surfaces with the same input slew and output load
+static inline void Scl_LibLookup2( SC_Timing * pTime, SC_Surface * pDelay, SC_Surface * pSlew, float slew, float load, float * pResDelay, float * pResSlew )
+{
+    float * pIndex0, * pIndex1, sfrac, lfrac;
+    int s, l;
+    if ( !pTime->fSameIndex )
     {
-        Vec_Flt_t * vTemp = (Vec_Flt_t *)Vec_PtrEntry(&p->vData, 0);
-        assert( Vec_PtrSize(&p->vData) == 1 );
-        assert( Vec_FltSize(vTemp) == 1 );
-        return Vec_FltEntry(vTemp, 0);
+        *pResDelay = Scl_LibLookup( pDelay, slew, load );
+        *pResSlew  = Scl_LibLookup( pSlew,  slew, load );
+        return;
     }
-
-    // Find closest sample points in surface:
-    pIndex0 = Vec_FltArray(&p->vIndex0);
-    for ( s = 1; s < Vec_FltSize(&p->vIndex0)-1; s++ )
-        if ( pIndex0[s] > slew )
-            break;
-    s--;
-
-    pIndex1 = Vec_FltArray(&p->vIndex1);
-    for ( l = 1; l < Vec_FltSize(&p->vIndex1)-1; l++ )
-        if ( pIndex1[l] > load )
-            break;
-    l--;
-
-    // Interpolate (or extrapolate) function value from sample points:
-    sfrac = (slew - pIndex0[s]) / (pIndex0[s+1] - pIndex0[s]);
-    lfrac = (load - pIndex1[l]) / (pIndex1[l+1] - pIndex1[l]);
-
-    pDataS  = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s) );
-    pDataS1 = Vec_FltArray( (Vec_Flt_t *)Vec_PtrEntry(&p->vData, s+1) );
-
-    p0 = pDataS [l] + lfrac * (pDataS [l+1] - pDataS [l]);
-    p1 = pDataS1[l] + lfrac * (pDataS1[l+1] - pDataS1[l]);
-
-    return p0 + sfrac * (p1 - p0);      // <<== multiply result with K factor here 
+    pIndex0 = pDelay->pTable;
+    pIndex1 = pIndex0 + 2 * pDelay->nTable0;
+    s = Scl_LibLookupSegment( pIndex0, pDelay->nTable0, slew );
+    l = Scl_LibLookupSegment( pIndex1, pDelay->nTable1, load );
+    sfrac = (slew - pIndex0[s]) * pIndex0[pDelay->nTable0 + s];
+    lfrac = (load - pIndex1[l]) * pIndex1[pDelay->nTable1 + l];
+    *pResDelay = Scl_LibLookupInterpolate( pIndex1 + 2 * pDelay->nTable1, pDelay->nTable1, s, l, sfrac, lfrac );
+    *pResSlew  = Scl_LibLookupInterpolate( pSlew->pTable + 2 * (pSlew->nTable0 + pSlew->nTable1), pSlew->nTable1, s, l, sfrac, lfrac );
 }
 static inline void Scl_LibPinArrival( SC_Timing * pTime, SC_Pair * pArrIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pArrOut, SC_Pair * pSlewOut )
 {
+    float DelayRise, DelayFall, SlewRise, SlewFall;
     if (pTime->tsense == sc_ts_Pos || pTime->tsense == sc_ts_Non)
     {
-        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->rise + Scl_LibLookup(&pTime->pCellRise,  pSlewIn->rise, pLoad->rise) );
-        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->fall + Scl_LibLookup(&pTime->pCellFall,  pSlewIn->fall, pLoad->fall) );
-        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                Scl_LibLookup(&pTime->pRiseTrans, pSlewIn->rise, pLoad->rise) );
-        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                Scl_LibLookup(&pTime->pFallTrans, pSlewIn->fall, pLoad->fall) );
+        Scl_LibLookup2( pTime, &pTime->pCellRise, &pTime->pRiseTrans, pSlewIn->rise, pLoad->rise, &DelayRise, &SlewRise );
+        Scl_LibLookup2( pTime, &pTime->pCellFall, &pTime->pFallTrans, pSlewIn->fall, pLoad->fall, &DelayFall, &SlewFall );
+        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->rise + DelayRise );
+        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->fall + DelayFall );
+        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                SlewRise  );
+        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                SlewFall  );
     }
     if (pTime->tsense == sc_ts_Neg || pTime->tsense == sc_ts_Non)
     {
-        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->fall + Scl_LibLookup(&pTime->pCellRise,  pSlewIn->fall, pLoad->rise) );
-        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->rise + Scl_LibLookup(&pTime->pCellFall,  pSlewIn->rise, pLoad->fall) );
-        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                Scl_LibLookup(&pTime->pRiseTrans, pSlewIn->fall, pLoad->rise) );
-        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                Scl_LibLookup(&pTime->pFallTrans, pSlewIn->rise, pLoad->fall) );
+        Scl_LibLookup2( pTime, &pTime->pCellRise, &pTime->pRiseTrans, pSlewIn->fall, pLoad->rise, &DelayRise, &SlewRise );
+        Scl_LibLookup2( pTime, &pTime->pCellFall, &pTime->pFallTrans, pSlewIn->rise, pLoad->fall, &DelayFall, &SlewFall );
+        pArrOut->rise  = Abc_MaxFloat( pArrOut->rise,  pArrIn->fall + DelayRise );
+        pArrOut->fall  = Abc_MaxFloat( pArrOut->fall,  pArrIn->rise + DelayFall );
+        pSlewOut->rise = Abc_MaxFloat( pSlewOut->rise,                SlewRise  );
+        pSlewOut->fall = Abc_MaxFloat( pSlewOut->fall,                SlewFall  );
     }
 }
 static inline void Scl_LibPinDeparture( SC_Timing * pTime, SC_Pair * pDepIn, SC_Pair * pSlewIn, SC_Pair * pLoad, SC_Pair * pDepOut )
@@ -734,12 +760,13 @@ static inline void Scl_LibHandleInputDriver2( SC_Cell * pCell, SC_PairI * pLoadI
 }
 
 /*=== sclLiberty.c ===============================================================*/
-extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose );
+extern SC_Lib *      Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, int fUseCache );
 /*=== sclLibScl.c ===============================================================*/
 extern SC_Lib *      Abc_SclReadFromGenlib( void * pLib );
 extern SC_Lib *      Abc_SclReadFromStr( Vec_Str_t * vOut );
 extern SC_Lib *      Abc_SclReadFromFile( char * pFileName );
 extern void          Abc_SclWriteScl( char * pFileName, SC_Lib * p );
+extern SC_Lib *      Abc_SclLibDup( SC_Lib * p );
 extern void          Abc_SclWriteLiberty( char * pFileName, SC_Lib * p );
 /*=== sclLibUtil.c ===============================================================*/
 extern void          Abc_SclHashCells( SC_Lib * p );
@@ -751,6 +778,7 @@ extern void          Abc_SclLinkCells( SC_Lib * p );
 extern void          Abc_SclPrintCells( SC_Lib * p, float Slew, float Gain, int fInvOnly, int fShort );
 extern void          Abc_SclConvertLeakageIntoArea( SC_Lib * p, float A, float B );
 extern void          Abc_SclLibNormalize( SC_Lib * p );
+extern void          Abc_SclLibPrepareTables( SC_Lib * p );
 extern SC_Cell *     Abc_SclFindInvertor( SC_Lib * p, int fFindBuff );
 extern SC_Cell *     Abc_SclFindSmallestGate( SC_Cell * p, float CinMin );
 extern SC_WireLoad * Abc_SclFindWireLoadModel( SC_Lib * p, float Area );
@@ -175,6 +175,7 @@ SC_Lib * Abc_SclReadFromGenlib( void * pLib0 )
     // hash gates by name
     Abc_SclHashCells( p );
     Abc_SclLinkCells( p );
+    Abc_SclLibPrepareTables( p );
     return p;
 }
 
@@ -443,6 +444,8 @@ SC_Lib * Abc_SclReadFromFile( char * pFileName )
         p->pFileName = Abc_UtilStrsav( pFileName );
     if ( p != NULL )
         Abc_SclLibNormalize( p );
+    if ( p != NULL )
+        Abc_SclLibPrepareTables( p );
     Vec_StrFree( vOut );
     return p;
 }
@@ -629,6 +632,31 @@ void Abc_SclWriteScl( char * pFileName, SC_Lib * p )
     Vec_StrFree( vOut );    
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Duplicates the library.]
+
+  Description [Serializes the library and reads it back.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+SC_Lib * Abc_SclLibDup( SC_Lib * p )
+{
+    SC_Lib * pNew;
+    Vec_Str_t * vOut = Vec_StrAlloc( 10000 );
+    Abc_SclWriteLibrary( vOut, p );
+    pNew = Abc_SclReadFromStr( vOut );
+    Vec_StrFree( vOut );
+    if ( pNew == NULL )
+        return NULL;
+    pNew->pFileName = Abc_UtilStrsav( p->pFileName );
+    Abc_SclLibPrepareTables( pNew );
+    return pNew;
+}
+
 
 /**Function*************************************************************
 
@@ -782,6 +782,74 @@ void Abc_SclLibNormalize( SC_Lib * p )
     }
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Derives lookup tables used for timing computation.]
+
+  Description [For each surface, creates one array with the slew points, 
+  the inverse steps between them, the load points, the inverse steps 
+  between them, and the table values (see Scl_LibLookup). A dimension 
+  with one point is extended to two identical points with zero inverse 
+  step, which makes the interpolation return the only available value.
+  Should be called after the library is loaded and normalized.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Abc_SclLibPrepareIndex( float * pTable, Vec_Flt_t * vIndex, int nTable )
+{
+    int i;
+    for ( i = 0; i < nTable; i++ )
+        pTable[i] = Vec_FltEntry( vIndex, Abc_MinInt(i, Vec_FltSize(vIndex)-1) );
+    for ( i = 0; i < nTable; i++ )
+        pTable[nTable + i] = (i < nTable-1 && pTable[i+1] != pTable[i]) ? 1.0 / (pTable[i+1] - pTable[i]) : 0;
+}
+void Abc_SclLibPrepareSurface( SC_Surface * p )
+{
+    float * pData;
+    int i, k;
+    assert( Vec_FltSize(&p->vIndex0) > 0 && Vec_FltSize(&p->vIndex1) > 0 );
+    assert( Vec_PtrSize(&p->vData) == Vec_FltSize(&p->vIndex0) );
+    ABC_FREE( p->pTable );
+    p->nTable0 = Abc_MaxInt( Vec_FltSize(&p->vIndex0), 2 );
+    p->nTable1 = Abc_MaxInt( Vec_FltSize(&p->vIndex1), 2 );
+    p->pTable  = ABC_ALLOC( float, 2 * p->nTable0 + 2 * p->nTable1 + p->nTable0 * p->nTable1 );
+    Abc_SclLibPrepareIndex( p->pTable, &p->vIndex0, p->nTable0 );
+    Abc_SclLibPrepareIndex( p->pTable + 2 * p->nTable0, &p->vIndex1, p->nTable1 );
+    pData = p->pTable + 2 * p->nTable0 + 2 * p->nTable1;
+    for ( i = 0; i < p->nTable0; i++ )
+    {
+        Vec_Flt_t * vRow = (Vec_Flt_t *)Vec_PtrEntry( &p->vData, Abc_MinInt(i, Vec_PtrSize(&p->vData)-1) );
+        assert( Vec_FltSize(vRow) == Vec_FltSize(&p->vIndex1) );
+        for ( k = 0; k < p->nTable1; k++ )
+            pData[i * p->nTable1 + k] = Vec_FltEntry( vRow, Abc_MinInt(k, Vec_FltSize(vRow)-1) );
+    }
+}
+void Abc_SclLibPrepareTables( SC_Lib * p )
+{
+    SC_Cell * pCell;
+    SC_Pin * pPin;
+    SC_Timings * pTimings;
+    SC_Timing * pTiming;
+    int i, k, m, n;
+    SC_LibForEachCell( p, pCell, i )
+    SC_CellForEachPin( pCell, pPin, k )
+    SC_PinForEachRTiming( pPin, pTimings, m )
+    Vec_PtrForEachEntry( SC_Timing *, &pTimings->vTimings, pTiming, n )
+    {
+        Abc_SclLibPrepareSurface( &pTiming->pCellRise );
+        Abc_SclLibPrepareSurface( &pTiming->pCellFall );
+        Abc_SclLibPrepareSurface( &pTiming->pRiseTrans );
+        Abc_SclLibPrepareSurface( &pTiming->pFallTrans );
+        pTiming->fSameIndex = Vec_FltEqual( &pTiming->pCellRise.vIndex0, &pTiming->pRiseTrans.vIndex0 ) && 
+                              Vec_FltEqual( &pTiming->pCellRise.vIndex1, &pTiming->pRiseTrans.vIndex1 ) &&
+                              Vec_FltEqual( &pTiming->pCellFall.vIndex0, &pTiming->pFallTrans.vIndex0 ) && 
+                              Vec_FltEqual( &pTiming->pCellFall.vIndex1, &pTiming->pFallTrans.vIndex1 );
+    }
+}
+
 /**Function*************************************************************
 
   Synopsis    [Derives simple GENLIB library.]
@@ -18,6 +18,8 @@
 
 ***********************************************************************/
 
+#include <sys/stat.h>
+
 #include "sclLib.h"
 #include "misc/st/st.h"
 #include "map/mio/mio.h"
@@ -1667,27 +1669,116 @@ Vec_Str_t * Scl_LibertyReadSclStr( Scl_Tree_t * p, int fVerbose, int fVeryVerbos
     }
     return vOut;
 }
-SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose )
+/**Function*************************************************************
+
+  Synopsis    [Binary cache of the parsed Liberty file.]
+
+  Description [The cache has the name of the Liberty file followed by 
+  ".scl" and contains the library in the SCL format, as produced by the 
+  parser, so it can also be read by command "read_scl". The cache is 
+  used if it is newer than the Liberty file and has the current version
+  of the SCL format. Otherwise, the Liberty file is parsed and the cache 
+  is rewritten.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Scl_LibertyCacheName( char * pFileName )
 {
-    SC_Lib * pLib;
-    Scl_Tree_t * p;
+    char * pCacheName = ABC_ALLOC( char, strlen(pFileName) + 5 );
+    sprintf( pCacheName, "%s.scl", pFileName );
+    return pCacheName;
+}
+Vec_Str_t * Scl_LibertyCacheRead( char * pFileName, char * pCacheName )
+{
+    struct stat StatLib, StatCache;
     Vec_Str_t * vStr;
-    p = Scl_LibertyParse( pFileName, fVeryVerbose );
-    if ( p == NULL )
+    FILE * pFile;
+    int nContents, RetValue, Pos = 0;
+    if ( stat(pFileName, &StatLib) != 0 || stat(pCacheName, &StatCache) != 0 )
         return NULL;
-//    Scl_LibertyParseDump( p, "temp_.lib" );
-    // collect relevant data
-    vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose );
-    Scl_LibertyStop( p, fVeryVerbose );
+    if ( StatCache.st_mtime <= StatLib.st_mtime || StatCache.st_size == 0 )
+        return NULL;
+    if ( (pFile = fopen( pCacheName, "rb" )) == NULL )
+        return NULL;
+    nContents = (int)StatCache.st_size;
+    vStr = Vec_StrAlloc( nContents );
+    RetValue = fread( Vec_StrArray(vStr), 1, nContents, pFile );
+    fclose( pFile );
+    vStr->nSize = RetValue;
+    if ( RetValue == nContents && Vec_StrGetI(vStr, &Pos) == ABC_SCL_CUR_VERSION )
+        return vStr;
+    Vec_StrFree( vStr );
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Reads the Liberty file into the SCL data-structure.]
+
+  Description [If fUseCache is set, the binary cache of the file is 
+  used if it is up to date, or written after parsing otherwise.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+SC_Lib * Abc_SclReadLiberty( char * pFileName, int fVerbose, int fVeryVerbose, int fUseCache )
+{
+    SC_Lib * pLib;
+    Scl_Tree_t * p;
+    Vec_Str_t * vStr = NULL;
+    char * pCacheName = NULL;
+    int fCached = 0;
+    abctime clk = Abc_Clock();
+    if ( fUseCache )
+    {
+        Scl_LibertyFixFileName( pFileName );
+        pCacheName = Scl_LibertyCacheName( pFileName );
+        vStr = Scl_LibertyCacheRead( pFileName, pCacheName );
+        fCached = (vStr != NULL);
+    }
+    if ( !fCached )
+    {
+        p = Scl_LibertyParse( pFileName, fVeryVerbose );
+        if ( p == NULL )
+        {
+            ABC_FREE( pCacheName );
+            return NULL;
+        }
+//        Scl_LibertyParseDump( p, "temp_.lib" );
+        // collect relevant data
+        vStr = Scl_LibertyReadSclStr( p, fVerbose, fVeryVerbose );
+        Scl_LibertyStop( p, fVeryVerbose );
+        if ( vStr != NULL && pCacheName != NULL )
+            Scl_LibertyStringDump( pCacheName, vStr );
+    }
     if ( vStr == NULL )
+    {
+        ABC_FREE( pCacheName );
         return NULL;
+    }
     // construct SCL data-structure
     pLib = Abc_SclReadFromStr( vStr );
+    Vec_StrFree( vStr );
     if ( pLib == NULL )
+    {
+        ABC_FREE( pCacheName );
         return NULL;
+    }
     pLib->pFileName = Abc_UtilStrsav( pFileName );
     Abc_SclLibNormalize( pLib );
-    Vec_StrFree( vStr );
+    Abc_SclLibPrepareTables( pLib );
+    if ( fVerbose && fCached )
+    {
+        printf( "Library \"%s\" from \"%s\" has %d cells (read from cache \"%s\").  ", 
+            pLib->pName, pFileName, SC_LibCellNum(pLib), pCacheName );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
+    ABC_FREE( pCacheName );
 //    printf( "Average slew = %.2f ps\n", Abc_SclComputeAverageSlew(pLib) );
     return pLib;
 }
@@ -27,6 +27,17 @@
 #include <windows.h>
 #endif
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -34,6 +45,31 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define SCL_PAR_THR_MAX   100   // the max number of threads
+#define SCL_PAR_CHUNK      64   // the number of nodes taken by a thread at a time
+#define SCL_PAR_LEVEL_MIN 256   // the min number of nodes in a level to start threads
+
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Scl_ParShare_t_ Scl_ParShare_t;
+struct Scl_ParShare_t_
+{
+    SC_Man *         pMan;           // the timing manager
+    Vec_Int_t *      vNodes;         // the nodes of the current level
+    int              fDept;          // computing departure times
+    int              iNext;          // the next node to be processed
+    pthread_mutex_t  Mutex;          // protects iNext
+};
+
+typedef struct Scl_ParThData_t_ Scl_ParThData_t;
+struct Scl_ParThData_t_
+{
+    Scl_ParShare_t * pShare;         // the shared data
+    int              nEstNodes;      // the number of estimations by this thread
+};
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -305,11 +341,11 @@ static inline void Abc_SclTimeCi( SC_Man * p, Abc_Obj_t * pObj )
         Scl_LibHandleInputDriver( p->pPiDrive, pLoad, pTime, pSlew );
     }
 }
-void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+static int Abc_SclTimeNodeInt( SC_Man * p, Abc_Obj_t * pObj, int fDept )
 {
     SC_Timing * pTime;
     SC_Cell * pCell;
-    int k;
+    int k, fEst = 0;
     SC_Pair * pLoad = Abc_SclObjLoad( p, pObj );
     float LoadRise = pLoad->rise;
     float LoadFall = pLoad->fall;
@@ -321,7 +357,7 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
     {
         assert( !fDept );
         Abc_SclTimeCi( p, pObj );
-        return;
+        return 0;
     }
     if ( Abc_ObjIsCo(pObj) )
     {
@@ -331,7 +367,7 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
             Vec_FltWriteEntry( p->vTimesOut, pObj->iData, Abc_SclObjTimeMax(p, pObj) );
             Vec_QueUpdate( p->vQue, pObj->iData );
         }
-        return;
+        return 0;
     }
     assert( Abc_ObjIsNode(pObj) );
 //    if ( !(Abc_ObjFaninNum(pObj) == 1 && Abc_ObjIsPi(Abc_ObjFanin0(pObj))) && p->EstLoadMax && Value > 1 )
@@ -348,7 +384,7 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
             pDepOut->rise += EstDelta;
             pDepOut->fall += EstDelta;
         }
-        p->nEstNodes++;
+        fEst = 1;
     }
     // get the library cell
     pCell = Abc_SclObjCell( pObj );
@@ -379,6 +415,11 @@ void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
             pArrOut->fall += EstDelta;
         }
     }
+    return fEst;
+}
+void Abc_SclTimeNode( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+{
+    p->nEstNodes += Abc_SclTimeNodeInt( p, pObj, fDept );
 }
 void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
 {
@@ -397,8 +438,236 @@ void Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone )
         printf( "after (%6.1f ps  %6.1f ps)\n", Abc_SclObjTimeOne(p, pObj, 1), Abc_SclObjTimeOne(p, pObj, 0) );
     }
 }
+/**Function*************************************************************
+
+  Synopsis    [Computes departure time of the node using its fanouts.]
+
+  Description [Produces the same result as propagating departure times 
+  of the fanouts to their fanins in Abc_SclTimeNode(), including buffer 
+  tree estimation, but only modifies the departure time of the node. 
+  Returns 1 if buffer tree estimation is used at the node.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Abc_SclDeptNode( SC_Man * p, Abc_Obj_t * pObj )
+{
+    SC_Pair * pDepIn  = Abc_SclObjDept( p, pObj );   // modified
+    SC_Pair * pSlewIn = Abc_SclObjSlew( p, pObj );
+    SC_Pair Load, DepOut;
+    Abc_Obj_t * pFanout, * pFanin;
+    float Value;
+    int i, k;
+    SC_PairClean( pDepIn );
+    Abc_ObjForEachFanout( pObj, pFanout, i )
+    {
+        if ( !Abc_ObjIsNode(pFanout) )
+            continue;
+        Load   = *Abc_SclObjLoad( p, pFanout );
+        DepOut = *Abc_SclObjDept( p, pFanout );
+        Value  = p->EstLoadMax ? Abc_SclObjLoadValue( p, pFanout ) : 0;
+        if ( p->EstLoadMax && Value > 1 )
+        {
+            float EstDelta = p->EstLinear * log( Value );
+            Load.rise    = p->EstLoadAve * p->EstLoadMax;
+            Load.fall    = p->EstLoadAve * p->EstLoadMax;
+            DepOut.rise += EstDelta;
+            DepOut.fall += EstDelta;
+        }
+        // the node may be connected to several pins of the fanout
+        Abc_ObjForEachFanin( pFanout, pFanin, k )
+            if ( pFanin == pObj )
+                Scl_LibPinDeparture( Scl_CellPinTime(Abc_SclObjCell(pFanout), k), pDepIn, pSlewIn, &Load, &DepOut );
+    }
+    if ( !Abc_ObjIsNode(pObj) || Abc_ObjFaninNum(pObj) == 0 )
+        return 0;
+    return p->EstLoadMax && Abc_SclObjLoadValue( p, pObj ) > 1;
+}
+static inline int Abc_SclTimeNodeLevel( SC_Man * p, Abc_Obj_t * pObj, int fDept )
+{
+    return fDept ? Abc_SclDeptNode( p, pObj ) : Abc_SclTimeNodeInt( p, pObj, 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Collects the objects by their logic level.]
+
+  Description [Level 0 contains the CIs and the constant nodes. The 
+  levels of other nodes are computed in the order of their IDs, which 
+  is the order used by the full timing update.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Vec_Wec_t * Abc_SclCollectLevels( SC_Man * p )
+{
+    Vec_Wec_t * vLevels;
+    Vec_Int_t * vLevel;
+    Abc_Obj_t * pObj, * pFanin;
+    int i, k, Level;
+    vLevel  = Vec_IntStart( Abc_NtkObjNumMax(p->pNtk) );
+    vLevels = Vec_WecStart( 1 );
+    Abc_NtkForEachCi( p->pNtk, pObj, i )
+        Vec_WecPush( vLevels, 0, Abc_ObjId(pObj) );
+    Abc_NtkForEachNode( p->pNtk, pObj, i )
+    {
+        Level = 0;
+        Abc_ObjForEachFanin( pObj, pFanin, k )
+            Level = Abc_MaxInt( Level, Vec_IntEntry(vLevel, Abc_ObjId(pFanin)) + 1 );
+        Vec_IntWriteEntry( vLevel, Abc_ObjId(pObj), Level );
+        Vec_WecPush( vLevels, Level, Abc_ObjId(pObj) );
+    }
+    Vec_IntFree( vLevel );
+    return vLevels;
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Computes timing of the nodes taken from the current level.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Abc_SclTimeNtkParThread( void * pArg )
+{
+    Scl_ParThData_t * pThData = (Scl_ParThData_t *)pArg;
+    Scl_ParShare_t * pShare = pThData->pShare;
+    SC_Man * p = pShare->pMan;
+    int i, iStart, iStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pShare->Mutex );
+        iStart = pShare->iNext;
+        pShare->iNext += SCL_PAR_CHUNK;
+        pthread_mutex_unlock( &pShare->Mutex );
+        if ( iStart >= Vec_IntSize(pShare->vNodes) )
+            break;
+        iStop = Abc_MinInt( iStart + SCL_PAR_CHUNK, Vec_IntSize(pShare->vNodes) );
+        for ( i = iStart; i < iStop; i++ )
+            pThData->nEstNodes += Abc_SclTimeNodeLevel( p, Abc_NtkObj(p->pNtk, Vec_IntEntry(pShare->vNodes, i)), pShare->fDept );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes timing of one level using several threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclTimeNtkLevelPar( SC_Man * p, Vec_Int_t * vNodes, int fDept )
+{
+    pthread_t WorkerThread[SCL_PAR_THR_MAX];
+    Scl_ParThData_t ThData[SCL_PAR_THR_MAX];
+    Scl_ParShare_t Share, * pShare = &Share;
+    int nProcs = Abc_MinInt( p->nProcs, SCL_PAR_THR_MAX );
+    int k, status;
+    memset( pShare, 0, sizeof(Scl_ParShare_t) );
+    pShare->pMan   = p;
+    pShare->vNodes = vNodes;
+    pShare->fDept  = fDept;
+    status = pthread_mutex_init( &pShare->Mutex, NULL );  assert( status == 0 );
+    for ( k = 0; k < nProcs; k++ )
+    {
+        ThData[k].pShare    = pShare;
+        ThData[k].nEstNodes = 0;
+    }
+    // the main thread is used as the last worker
+    for ( k = 0; k < nProcs - 1; k++ )
+    {
+        status = pthread_create( WorkerThread + k, NULL, Abc_SclTimeNtkParThread, (void *)(ThData + k) );  
+        assert( status == 0 );
+    }
+    Abc_SclTimeNtkParThread( (void *)(ThData + nProcs - 1) );
+    for ( k = 0; k < nProcs - 1; k++ )
+    {
+        status = pthread_join( WorkerThread[k], NULL );  
+        assert( status == 0 );
+    }
+    for ( k = 0; k < nProcs; k++ )
+        p->nEstNodes += ThData[k].nEstNodes;
+    pthread_mutex_destroy( &pShare->Mutex );
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Computes timing of the nodes level by level.]
+
+  Description [Arrival times are computed for the levels in the direct 
+  order, departure times for the levels in the reverse order. In both 
+  cases, a node only modifies its own timing information and reads that 
+  of its fanins (or fanouts), which are on other levels. Because of this, 
+  the nodes of a large level are processed concurrently and the result 
+  does not depend on the number of threads. The CIs and the COs are not 
+  processed here because they update the shared data structures.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Abc_SclTimeNtkLevel( SC_Man * p, Vec_Int_t * vNodes, int fDept )
+{
+    Abc_Obj_t * pObj;
+    int i;
+#ifdef ABC_USE_PTHREADS
+    if ( p->nProcs > 1 && Vec_IntSize(vNodes) >= SCL_PAR_LEVEL_MIN )
+    {
+        Abc_SclTimeNtkLevelPar( p, vNodes, fDept );
+        return;
+    }
+#endif
+    Abc_NtkForEachObjVec( vNodes, p->pNtk, pObj, i )
+        p->nEstNodes += Abc_SclTimeNodeLevel( p, pObj, fDept );
+}
+void Abc_SclTimeNtkLevels( SC_Man * p, Vec_Wec_t * vLevels, int fDept )
+{
+    Vec_Int_t * vNodes;
+    int i;
+    if ( fDept )
+    {
+        Vec_WecForEachLevelReverse( vLevels, vNodes, i )
+            Abc_SclTimeNtkLevel( p, vNodes, 1 );
+    }
+    else
+    {
+        Vec_WecForEachLevelStart( vLevels, vNodes, i, 1 )
+            Abc_SclTimeNtkLevel( p, vNodes, 0 );
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Full timing update of the network.]
+
+  Description [If more than one thread is requested, the nodes are 
+  processed level by level by Abc_SclTimeNtkLevels().]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
 void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser )
 {
+    Vec_Wec_t * vLevels = NULL;
     Abc_Obj_t * pObj;
     float D;
     int i;
@@ -407,8 +676,16 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     p->nEstNodes = 0;
     Abc_NtkForEachCi( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
-    Abc_NtkForEachNode1( p->pNtk, pObj, i )
-        Abc_SclTimeNode( p, pObj, 0 );
+    if ( p->nProcs > 1 )
+    {
+        vLevels = Abc_SclCollectLevels( p );
+        Abc_SclTimeNtkLevels( p, vLevels, 0 );
+    }
+    else
+    {
+        Abc_NtkForEachNode1( p->pNtk, pObj, i )
+            Abc_SclTimeNode( p, pObj, 0 );
+    }
     Abc_NtkForEachCo( p->pNtk, pObj, i )
         Abc_SclTimeNode( p, pObj, 0 );
     D = Abc_SclReadMaxDelay( p );
@@ -421,9 +698,15 @@ void Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fRe
     if ( fReverse )
     {
         p->nEstNodes = 0;
-        Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
-            Abc_SclTimeNode( p, pObj, 1 );
+        if ( vLevels )
+            Abc_SclTimeNtkLevels( p, vLevels, 1 );
+        else
+        {
+            Abc_NtkForEachNodeReverse1( p->pNtk, pObj, i )
+                Abc_SclTimeNode( p, pObj, 1 );
+        }
     }
+    Vec_WecFreeP( &vLevels );
 }
 
 /**Function*************************************************************
@@ -483,7 +766,7 @@ static inline void Abc_SclTimeIncUpdateArrival( SC_Man * p )
     SC_Pair ArrOut, SlewOut;
     SC_Pair * pArrOut, *pSlewOut;
     Abc_Obj_t * pObj;
-    float E = (float)0.1;
+    float E = p->IncEpsilon;
     int i, k;
     Vec_WecForEachLevel( p->vLevels, vLevel, i )
     {
@@ -513,7 +796,7 @@ static inline void Abc_SclTimeIncUpdateDeparture( SC_Man * p )
     Vec_Int_t * vLevel;
     SC_Pair DepOut, * pDepOut;
     Abc_Obj_t * pObj;
-    float E = (float)0.1;
+    float E = p->IncEpsilon;
     int i, k;
     Vec_WecForEachLevelReverse( p->vLevels, vLevel, i )
     {
@@ -553,7 +836,8 @@ int Abc_SclTimeIncUpdate( SC_Man * p )
     }
     Vec_IntClear( p->vChanged );
     Abc_SclTimeIncUpdateArrival( p );
-    Abc_SclTimeIncUpdateDeparture( p );
+    if ( p->fUseDept )
+        Abc_SclTimeIncUpdateDeparture( p );
     Abc_SclTimeIncUpdateClean( p );
     RetValue = p->nIncUpdates;
     p->nIncUpdates = 0;
@@ -630,9 +914,10 @@ void Abc_SclManReadSlewAndLoad( SC_Man * p, Abc_Ntk_t * pNtk )
   SeeAlso     []
 
 ***********************************************************************/
-SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio )
+SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nProcs )
 {
     SC_Man * p = Abc_SclManAlloc( pLib, pNtk );
+    p->nProcs = nProcs;
     if ( nTreeCRatio )
     {
         p->EstLoadMax = 0.01 * nTreeCRatio;  // max ratio of Cout/Cave when the estimation is used
@@ -652,6 +937,7 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
             p->pWLoadUsed = Abc_SclFetchWireLoadModel( pLib, pNtk->pWLoadUsed );
     }
     Abc_SclTimeNtkRecompute( p, &p->SumArea0, &p->MaxDelay0, fDept, DUser );
+    p->fUseDept = fDept;
     p->SumArea  = p->SumArea0;
     p->MaxDelay = p->MaxDelay0;
     return p;
@@ -668,10 +954,10 @@ SC_Man * Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nProcs )
 {
     SC_Man * p;
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio );
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, nTreeCRatio, nProcs );
     Abc_SclTimeNtkPrint( p, fShowAll, fPrintPath );
     if ( fDumpStats )
         Abc_SclDumpStats( p, "stats.txt", 0 );
@@ -689,12 +975,12 @@ void Abc_SclTimePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, in
   SeeAlso     []
 
 ***********************************************************************/
-void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats )
+void Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nProcs )
 {
     Abc_Ntk_t * pNtkNew = pNtk;
     if ( pNtk->nBarBufs2 > 0 )
         pNtkNew = Abc_NtkDupDfsNoBarBufs( pNtk );
-    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats );
+    Abc_SclTimePerformInt( pLib, pNtkNew, nTreeCRatio, fUseWireLoads, fShowAll, fPrintPath, fDumpStats, nProcs );
     if ( pNtk->nBarBufs2 > 0 )
         Abc_NtkDelete( pNtkNew );
 }
@@ -899,7 +1185,7 @@ void Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose )
     int fUseWireLoads = 0;
     SC_Man * p;
     assert( Abc_NtkIsMappedLogic(pNtk) );
-    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000 ); 
+    p = Abc_SclManStart( pLib, pNtk, fUseWireLoads, 1, 0, 10000, 1 ); 
     Abc_SclPrintBufferTrees( p, pNtk ); 
 //    Abc_SclPrintFaninPairs( p, pNtk );
     Abc_SclManFree( p );
@@ -79,9 +79,12 @@ struct SC_Man_
     Vec_Int_t *    vNodeIter;     // the last iteration the node was upsized
     Vec_Int_t *    vBestFans;     // best fanouts
     // incremental timing update
-    Vec_Wec_t *    vLevels;
-    Vec_Int_t *    vChanged; 
-    int            nIncUpdates;
+    Vec_Wec_t *    vLevels;       // nodes to update by level
+    Vec_Int_t *    vChanged;      // nodes whose cells have changed
+    int            nIncUpdates;   // the number of updated nodes
+    int            fUseDept;      // departure times are maintained
+    float          IncEpsilon;    // the smallest change that is propagated
+    int            nProcs;        // the number of threads used for full timing
     // optimization parameters
     float          SumArea;       // total area
     float          MaxDelay;      // max delay
@@ -180,6 +183,7 @@ static inline SC_Man * Abc_SclManAlloc( SC_Lib * pLib, Abc_Ntk_t * pNtk )
     p->vNodeIter   = Vec_IntStartFull( p->nObjs );
     p->vLevels     = Vec_WecStart( 2 * Abc_NtkLevel(pNtk) + 1 );
     p->vChanged    = Vec_IntAlloc( 100 );
+    p->IncEpsilon  = (float)0.1;
     Abc_NtkForEachCo( pNtk, pObj, i )
         pObj->Level = Abc_ObjFanin0(pObj)->Level + 1;
     // set CI/CO ids
@@ -563,13 +567,13 @@ extern void          Abc_SclUpdateLoadSplit( SC_Man * p, Abc_Obj_t * pBuffer, Ab
 extern Abc_Obj_t *   Abc_SclFindCriticalCo( SC_Man * p, int * pfRise );
 extern Abc_Obj_t *   Abc_SclFindMostCriticalFanin( SC_Man * p, int * pfRise, Abc_Obj_t * pNode );
 extern void          Abc_SclTimeNtkPrint( SC_Man * p, int fShowAll, int fPrintPath );
-extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio );
+extern SC_Man *      Abc_SclManStart( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fUseWireLoads, int fDept, float DUser, int nTreeCRatio, int nProcs );
 extern void          Abc_SclTimeCone( SC_Man * p, Vec_Int_t * vCone );
 extern void          Abc_SclTimeNtkRecompute( SC_Man * p, float * pArea, float * pDelay, int fReverse, float DUser );
 extern int           Abc_SclTimeIncUpdate( SC_Man * p );
 extern void          Abc_SclTimeIncInsert( SC_Man * p, Abc_Obj_t * pObj );
 extern void          Abc_SclTimeIncUpdateLevel( Abc_Obj_t * pObj );
-extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats );
+extern void          Abc_SclTimePerform( SC_Lib * pLib, Abc_Ntk_t * pNtk, int nTreeCRatio, int fUseWireLoads, int fShowAll, int fPrintPath, int fDumpStats, int nProcs );
 extern void          Abc_SclPrintBuffers( SC_Lib * pLib, Abc_Ntk_t * pNtk, int fVerbose );
 /*=== sclUpsize.c ===============================================================*/
 extern int           Abc_SclCountNearCriticalNodes( SC_Man * p );
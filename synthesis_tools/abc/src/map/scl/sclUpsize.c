@@ -890,7 +890,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
     if ( pPars->Window == 1 )
         pPars->Window += (Abc_NtkNodeNum(pNtk) > 40000);
     // prepare the manager; collect init stats
-    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst );
+    p = Abc_SclManStart( pLib, pNtk, pPars->fUseWireLoads, pPars->fUseDept, 0, pPars->BuffTreeEst, pPars->nProcs );
     p->timeTotal  = Abc_Clock();
     assert( p->vGatesBest == NULL );
     p->vGatesBest = Vec_IntDup( p->pNtk->vGates );
@@ -933,13 +933,10 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
 
         // update timing information
         clk = Abc_Clock();
-        if ( pPars->fUseDept )
-        {
-            if ( Vec_IntSize(p->vChanged) && !(pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0) )
-                nConeSize = Abc_SclTimeIncUpdate( p );
-            else
-                Abc_SclTimeNtkRecompute( p, NULL, NULL, pPars->fUseDept, 0 );
-        }
+        if ( Vec_IntSize(p->vChanged) && !(pPars->BypassFreq && i && (i % pPars->BypassFreq) == 0) )
+            nConeSize = Abc_SclTimeIncUpdate( p );
+        else if ( pPars->fUseDept )
+            Abc_SclTimeNtkRecompute( p, NULL, NULL, pPars->fUseDept, 0 );
         else
         {
             Vec_Int_t * vTFO = Abc_SclFindTFO( p->pNtk, vPathNodes );
@@ -947,6 +944,7 @@ void Abc_SclUpsizePerformInt( SC_Lib * pLib, Abc_Ntk_t * pNtk, SC_SizePars * pPa
             nConeSize = Vec_IntSize( vTFO );
             Vec_IntFree( vTFO );
         }
+        Vec_IntClear( p->vChanged );
         p->timeTime += Abc_Clock() - clk;
 //        Abc_SclUpsizePrintDiffs( p, pLib, pNtk );
 
@@ -53,6 +53,17 @@
 #define ABC_DLL ABC_DLLIMPORT
 #endif
 
+// thread-local storage for the global data (each thread has its own frame)
+#if defined(_MSC_VER)
+#define ABC_THREAD_LOCAL __declspec(thread)
+#elif defined(__GNUC__) || defined(__clang__)
+#define ABC_THREAD_LOCAL __thread
+#elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+#define ABC_THREAD_LOCAL _Thread_local
+#else
+#define ABC_THREAD_LOCAL
+#endif
+
 #if !defined(___unused)
 #if defined(__GNUC__)
 #define ___unused __attribute__ ((__unused__))
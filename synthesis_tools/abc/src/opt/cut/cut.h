@@ -71,6 +71,7 @@ struct Cut_ParamsStruct_t_
     int                fMap;              // computes delay of FPGA mapping with cuts
     int                fAdjust;           // removed useless fanouts of XORs/MUXes
     int                fNpnSave;          // enables dumping 6-input truth tables
+    int                fFanins;           // record the fanins of the nodes (for incremental update)
     int                fVerbose;          // the verbosiness flag
 };
 
@@ -116,10 +117,13 @@ extern void             Cut_NodeWriteCutsTemp( Cut_Man_t * p, int Node, Cut_Cut_
 extern void             Cut_NodeSetTriv( Cut_Man_t * p, int Node );
 extern void             Cut_NodeTryDroppingCuts( Cut_Man_t * p, int Node );
 extern void             Cut_NodeFreeCuts( Cut_Man_t * p, int Node );
+extern int              Cut_NodeCheckFanins( Cut_Man_t * p, int Node, int Node0, int Node1, int fCompl0, int fCompl1 );
 /*=== cutCut.c ==========================================================*/
 extern void             Cut_CutPrint( Cut_Cut_t * pCut, int fSeq );
 extern void             Cut_CutPrintList( Cut_Cut_t * pList, int fSeq );
 extern int              Cut_CutCountList( Cut_Cut_t * pList );
+extern void             Cut_CutRecycleList( Cut_Man_t * p, Cut_Cut_t * pList );
+extern int              Cut_CutListEqual( Cut_Cut_t * pList1, Cut_Cut_t * pList2 );
 /*=== cutMan.c ==========================================================*/
 extern Cut_Man_t *      Cut_ManStart( Cut_Params_t * pParams );
 extern void             Cut_ManStop( Cut_Man_t * p );
@@ -131,6 +135,7 @@ extern int              Cut_ManReadVarsMax( Cut_Man_t * p );
 extern Cut_Params_t *   Cut_ManReadParams( Cut_Man_t * p );
 extern Vec_Int_t *      Cut_ManReadNodeAttrs( Cut_Man_t * p );
 extern void             Cut_ManIncrementDagNodes( Cut_Man_t * p );
+extern void             Cut_ManRemapIds( Cut_Man_t * p, Vec_Int_t * vMap );
 /*=== cutNode.c ==========================================================*/
 extern Cut_Cut_t *      Cut_NodeComputeCuts( Cut_Man_t * p, int Node, int Node0, int Node1, int fCompl0, int fCompl1, int fTriv, int TreeCode ); 
 extern Cut_Cut_t *      Cut_NodeUnionCuts( Cut_Man_t * p, Vec_Int_t * vNodes );
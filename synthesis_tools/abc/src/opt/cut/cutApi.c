@@ -193,6 +193,26 @@ void Cut_NodeFreeCuts( Cut_Man_t * p, int Node )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Checks if the node has the same fanins as when its cuts were computed.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cut_NodeCheckFanins( Cut_Man_t * p, int Node, int Node0, int Node1, int fCompl0, int fCompl1 )
+{
+    assert( p->vFanins );
+    if ( 2 * Node + 1 >= Vec_IntSize(p->vFanins) )
+        return 0;
+    return Vec_IntEntry(p->vFanins, 2 * Node + 0) == Abc_Var2Lit(Node0, fCompl0) &&
+           Vec_IntEntry(p->vFanins, 2 * Node + 1) == Abc_Var2Lit(Node1, fCompl1);
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -106,6 +106,41 @@ int Cut_CutCompare( Cut_Cut_t * pCut1, Cut_Cut_t * pCut2 )
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Checks if the two lists contain the same cuts.]
+
+  Description [The cuts are compared by their leaves and truth tables.
+  The order of the cuts in the lists may be different.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Cut_CutListEqual( Cut_Cut_t * pList1, Cut_Cut_t * pList2 )
+{
+    Cut_Cut_t * pCut1, * pCut2;
+    if ( Cut_CutCountList(pList1) != Cut_CutCountList(pList2) )
+        return 0;
+    Cut_ListForEachCut( pList1, pCut1 )
+    {
+        Cut_ListForEachCut( pList2, pCut2 )
+        {
+            if ( pCut1->uSign != pCut2->uSign || pCut1->nVarsMax != pCut2->nVarsMax )
+                continue;
+            if ( Cut_CutCompare( pCut1, pCut2 ) )
+                continue;
+            if ( memcmp( Cut_CutReadTruth(pCut1), Cut_CutReadTruth(pCut2), sizeof(unsigned) * Cut_TruthWords(pCut1->nVarsMax) ) )
+                continue;
+            break;
+        }
+        if ( pCut2 == NULL )
+            return 0;
+    }
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Duplicates the list.]
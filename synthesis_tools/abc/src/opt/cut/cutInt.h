@@ -55,6 +55,7 @@ struct Cut_ManStruct_t_
     Vec_Ptr_t *        vCutsNew;         // new cuts by node ID
     Vec_Ptr_t *        vCutsOld;         // old cuts by node ID
     Vec_Ptr_t *        vCutsTemp;        // temp cuts for cutset nodes by cutset node number
+    Vec_Int_t *        vFanins;          // the fanin literals of the nodes whose cuts are computed
     // memory management
     Extra_MmFixed_t *  pMmCuts;
     int                EntrySize;
@@ -133,7 +134,6 @@ extern Cut_Cut_t *         Cut_CutAlloc( Cut_Man_t * p );
 extern void                Cut_CutRecycle( Cut_Man_t * p, Cut_Cut_t * pCut );
 extern int                 Cut_CutCompare( Cut_Cut_t * pCut1, Cut_Cut_t * pCut2 );
 extern Cut_Cut_t *         Cut_CutDupList( Cut_Man_t * p, Cut_Cut_t * pList );
-extern void                Cut_CutRecycleList( Cut_Man_t * p, Cut_Cut_t * pList );
 extern Cut_Cut_t *         Cut_CutMergeLists( Cut_Cut_t * pList1, Cut_Cut_t * pList2 ); 
 extern void                Cut_CutNumberList( Cut_Cut_t * pList );
 extern Cut_Cut_t *         Cut_CutCreateTriv( Cut_Man_t * p, int Node );
@@ -97,6 +97,9 @@ Cut_Man_t * Cut_ManStart( Cut_Params_t * pParams )
         p->vNodeStarts = Vec_IntStart( pParams->nIdsMax );
         p->vCutPairs   = Vec_IntAlloc( 0 );
     }
+    // enable recording the fanins
+    if ( pParams->fFanins )
+        p->vFanins = Vec_IntStartFull( 2 * pParams->nIdsMax );
     // allocate storage for delays
     if ( pParams->fMap && !p->pParams->fSeq )
     {
@@ -128,6 +131,7 @@ void Cut_ManStop( Cut_Man_t * p )
     if ( p->vCutsTemp )   Vec_PtrFree( p->vCutsTemp );
     if ( p->vFanCounts )  Vec_IntFree( p->vFanCounts );
     if ( p->vTemp )       Vec_PtrFree( p->vTemp );
+    if ( p->vFanins )     Vec_IntFree( p->vFanins );
 
     if ( p->vCutsMax )    Vec_PtrFree( p->vCutsMax );
     if ( p->vDelays )     Vec_IntFree( p->vDelays );
@@ -311,6 +315,106 @@ void Cut_ManIncrementDagNodes( Cut_Man_t * p )
     p->nNodesDag++;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Renumbers the leaves of the cut.]
+
+  Description [Returns 0 if some leaf does not have a new ID. Otherwise,
+  sorts the leaves by their new IDs, permutes the truth table accordingly, 
+  and updates the signature.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Cut_CutRemapLeaves( Cut_Man_t * p, Cut_Cut_t * pCut, Vec_Int_t * vMap )
+{
+    int i, k, Temp;
+    for ( i = 0; i < (int)pCut->nLeaves; i++ )
+    {
+        if ( pCut->pLeaves[i] >= Vec_IntSize(vMap) || Vec_IntEntry(vMap, pCut->pLeaves[i]) < 0 )
+            return 0;
+        pCut->pLeaves[i] = Vec_IntEntry( vMap, pCut->pLeaves[i] );
+    }
+    for ( i = 0; i < (int)pCut->nLeaves - 1; i++ )
+    for ( k = 0; k < (int)pCut->nLeaves - 1 - i; k++ )
+    {
+        if ( pCut->pLeaves[k] < pCut->pLeaves[k+1] )
+            continue;
+        Temp = pCut->pLeaves[k];
+        pCut->pLeaves[k] = pCut->pLeaves[k+1];
+        pCut->pLeaves[k+1] = Temp;
+        if ( p->pParams->fTruth )
+        {
+            Extra_TruthSwapAdjacentVars( p->puTemp[0], Cut_CutReadTruth(pCut), pCut->nVarsMax, k );
+            Extra_TruthCopy( Cut_CutReadTruth(pCut), p->puTemp[0], pCut->nVarsMax );
+        }
+    }
+    pCut->uSign = 0;
+    for ( i = 0; i < (int)pCut->nLeaves; i++ )
+        pCut->uSign |= Cut_NodeSign( pCut->pLeaves[i] );
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Transfers the cuts to the new node IDs.]
+
+  Description [The map gives the new ID for each old ID, or -1 if the
+  node was removed. The cuts of the removed nodes and the cuts with 
+  removed leaves are recycled. The recorded fanins are renumbered too.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cut_ManRemapIds( Cut_Man_t * p, Vec_Int_t * vMap )
+{
+    Vec_Ptr_t * vCutsNew;
+    Vec_Int_t * vFanins = NULL;
+    Cut_Cut_t * pList, * pCut;
+    int i, k, iLit;
+    assert( !p->pParams->fSeq && !p->pParams->fRecord && !p->pParams->fMap );
+    vCutsNew = Vec_PtrStart( Vec_IntSize(vMap) );
+    if ( p->vFanins )
+        vFanins = Vec_IntStartFull( 2 * Vec_IntSize(vMap) );
+    Vec_PtrForEachEntry( Cut_Cut_t *, p->vCutsNew, pList, i )
+    {
+        if ( pList == NULL )
+            continue;
+        if ( i >= Vec_IntSize(vMap) || Vec_IntEntry(vMap, i) < 0 )
+        {
+            Cut_CutRecycleList( p, pList );
+            continue;
+        }
+        Cut_ListForEachCut( pList, pCut )
+            if ( !Cut_CutRemapLeaves( p, pCut, vMap ) )
+                break;
+        if ( pCut != NULL )
+        {
+            Cut_CutRecycleList( p, pList );
+            continue;
+        }
+        Vec_PtrWriteEntry( vCutsNew, Vec_IntEntry(vMap, i), pList );
+        // transfer the fanins
+        for ( k = 0; vFanins && k < 2 && 2 * i + k < Vec_IntSize(p->vFanins); k++ )
+        {
+            iLit = Vec_IntEntry( p->vFanins, 2 * i + k );
+            if ( iLit >= 0 && Abc_Lit2Var(iLit) < Vec_IntSize(vMap) && Vec_IntEntry(vMap, Abc_Lit2Var(iLit)) >= 0 )
+                Vec_IntWriteEntry( vFanins, 2 * Vec_IntEntry(vMap, i) + k, Abc_Var2Lit(Vec_IntEntry(vMap, Abc_Lit2Var(iLit)), Abc_LitIsCompl(iLit)) );
+        }
+    }
+    Vec_PtrFree( p->vCutsNew );
+    p->vCutsNew = vCutsNew;
+    if ( vFanins )
+    {
+        Vec_IntFree( p->vFanins );
+        p->vFanins = vFanins;
+    }
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
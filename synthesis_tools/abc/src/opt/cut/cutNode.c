@@ -374,6 +374,13 @@ Cut_Cut_t * Cut_NodeComputeCuts( Cut_Man_t * p, int Node, int Node0, int Node1,
     // start the number of cuts at the node
     p->nNodes++;
     p->nNodeCuts = 0;
+    // remember the fanins
+    if ( p->vFanins )
+    {
+        Vec_IntFillExtra( p->vFanins, 2 * (Node + 1), -1 );
+        Vec_IntWriteEntry( p->vFanins, 2 * Node + 0, Abc_Var2Lit(Node0, fCompl0) );
+        Vec_IntWriteEntry( p->vFanins, 2 * Node + 1, Abc_Var2Lit(Node1, fCompl1) );
+    }
     // prepare information for recording
     if ( p->pParams->fRecord )
     {
@@ -105,7 +105,7 @@ struct Dar_Lib_t_ // library
     unsigned char *  pMap;
 };
 
-static Dar_Lib_t * s_DarLib = NULL;
+static ABC_THREAD_LOCAL Dar_Lib_t * s_DarLib = NULL;
 
 static inline Dar_LibObj_t * Dar_LibObj( Dar_Lib_t * p, int Id )    { return p->pObjs + Id; }
 static inline int            Dar_LibObjTruth( Dar_LibObj_t * pObj ) { return pObj->Num < (0xFFFF & ~pObj->Num) ? pObj->Num : (0xFFFF & ~pObj->Num); }
@@ -87,6 +87,10 @@ extern void          Abc_TtHieManStop(Abc_TtHieMan_t * p );
 extern unsigned      Abc_TtCanonicizeWrap(TtCanonicizeFunc func, Abc_TtHieMan_t * p, word * pTruth, int nVars, char * pCanonPerm, int flag);
 extern unsigned      Abc_TtCanonicizeAda(Abc_TtHieMan_t * p, word * pTruth, int nVars, char * pCanonPerm, int iThres);
 extern unsigned      Abc_TtCanonicizeHie(Abc_TtHieMan_t * p, word * pTruthInit, int nVars, char * pCanonPerm, int fExact);
+/*=== dauCanon6.c ==========================================================*/
+extern unsigned      Abc_TtCanonicizeExact( word * pTruth, int nVars, char * pCanonPerm );
+extern char *        Abc_TtCanonicizeExactKernelName( int iKernel );
+extern int           Abc_TtCanonicizeExactKernelSelect( int iKernel );
 /*=== dauCount.c ==========================================================*/
 extern int           Abc_TtCountOnesInCofsQuick( word * pTruth, int nVars, int * pStore );
 /*=== dauDsd.c  ==========================================================*/
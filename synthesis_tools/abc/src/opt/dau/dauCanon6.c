@@ -0,0 +1,553 @@
+/**CFile****************************************************************
+
+  FileName    [dauCanon6.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [DAG-aware unmapping.]
+
+  Synopsis    [Exact NPN canonization of functions with up to 6 inputs.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 19, 2026.]
+
+  Revision    [$Id: dauCanon6.c,v 1.00 2026/10/19 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "dauInt.h"
+#include "misc/util/utilTruth.h"
+
+#if defined(__GNUC__) && (defined(__x86_64__) || defined(__i386__)) && !defined(ABC_CANON_NO_SIMD)
+#include <immintrin.h>
+#define DAU_CANON_USE_X86
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+// The canonical form is the smallest truth table in the NPN class, that is,
+// the same representative as computed by the exhaustive enumeration in
+// "lucky" (testnpn -A 1) and by exact_npn_canonization() in "kitty".
+//
+// The candidates are the partially transformed truth tables. Each of them
+// is paired with its configuration: the input variable placed in position i
+// is stored in bits [4i, 4i+3], the phase of position i is stored in bit
+// 32+4i, and the output phase is stored in bit 60. This encoding allows for
+// updating the configuration by the same delta-swap as the truth table.
+
+// the candidate expansion kernel (returns -1 if the new candidates do not fit)
+typedef int (*Dau_CanonExpandFunc_t)( word * pG, word * pC, int nCands, int k, int nVars, word * pGNew, word * pCNew, int nCap );
+
+// the kernel used by the calling thread (selected on the first use)
+static ABC_THREAD_LOCAL Dau_CanonExpandFunc_t s_CanonExpandFunc = NULL;
+
+// the minterms, in which w variables in positions nFixed and above are equal to 1
+static word s_CanonWeightMasks[7][7] = {
+    { ABC_CONST(0x0000000000000001), ABC_CONST(0x0000000100010116), ABC_CONST(0x0001011601161668), ABC_CONST(0x0116166816686880), ABC_CONST(0x1668688068808000), ABC_CONST(0x6880800080000000), ABC_CONST(0x8000000000000000) },
+    { ABC_CONST(0x0000000000000003), ABC_CONST(0x000000030003033C), ABC_CONST(0x0003033C033C3CC0), ABC_CONST(0x033C3CC03CC0C000), ABC_CONST(0x3CC0C000C0000000), ABC_CONST(0xC000000000000000), ABC_CONST(0x0000000000000000) },
+    { ABC_CONST(0x000000000000000F), ABC_CONST(0x0000000F000F0FF0), ABC_CONST(0x000F0FF00FF0F000), ABC_CONST(0x0FF0F000F0000000), ABC_CONST(0xF000000000000000), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000) },
+    { ABC_CONST(0x00000000000000FF), ABC_CONST(0x000000FF00FFFF00), ABC_CONST(0x00FFFF00FF000000), ABC_CONST(0xFF00000000000000), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000) },
+    { ABC_CONST(0x000000000000FFFF), ABC_CONST(0x0000FFFFFFFF0000), ABC_CONST(0xFFFF000000000000), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000) },
+    { ABC_CONST(0x00000000FFFFFFFF), ABC_CONST(0xFFFFFFFF00000000), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000) },
+    { ABC_CONST(0xFFFFFFFFFFFFFFFF), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000), ABC_CONST(0x0000000000000000) }
+};
+
+// the number of candidates stored on the stack
+#define DAU_CANON_CANDS  1024
+
+static inline word Dau_CanonSwapConfig( word c, int k, int q )
+{
+    int  Shift = 4 * (q - k);
+    word Mask  = ((word)0xF << (4*k)) | ((word)1 << (32+4*k));
+    word x     = ((c >> Shift) ^ c) & Mask;
+    return c ^ x ^ (x << Shift);
+}
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Places each variable into position k and keeps the best.]
+
+  Description [The candidates have positions 0, 1, ..., k-1 fixed.
+  Placing variable q (k <= q < nVars) into position k fixes the upper
+  2^(k+1) bits of the truth table, because they correspond to the minterms
+  where all variables in positions above k are equal to 1. Only the children
+  with the smallest value of these bits can lead to the smallest truth table.
+  The first pass finds this value, the second pass collects the children.
+  The children are visited in the same order by all kernels.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dau_CanonExpandWord64( word * pG, word * pC, int nCands, int k, int nVars, word * pGNew, word * pCNew, int nCap )
+{
+    int q, i, nNew = 0, KeyShift = 64 - (2 << k);
+    word g, KeyMin = ~(word)0;
+    for ( q = k; q < nVars; q++ )
+    for ( i = 0; i < nCands; i++ )
+    {
+        g = q == k ? pG[i] : Abc_Tt6SwapVars( pG[i], k, q );
+        KeyMin = Abc_MinWord( KeyMin, g >> KeyShift );
+    }
+    for ( q = k; q < nVars; q++ )
+    for ( i = 0; i < nCands; i++ )
+    {
+        g = q == k ? pG[i] : Abc_Tt6SwapVars( pG[i], k, q );
+        if ( (g >> KeyShift) != KeyMin )
+            continue;
+        if ( nNew == nCap )
+            return -1;
+        pGNew[nNew]   = g;
+        pCNew[nNew++] = q == k ? pC[i] : Dau_CanonSwapConfig( pC[i], k, q );
+    }
+    return nNew;
+}
+
+#ifdef DAU_CANON_USE_X86
+
+/**Function*************************************************************
+
+  Synopsis    [Places each variable into position k using AVX2.]
+
+  Description [Four candidates are processed at once. Since the swapped
+  variables are the same for all of them, the shifts have the same count
+  in all lanes. The keys have at most 32 bits, so the signed comparison
+  of 64-bit lanes can be used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+__attribute__((target("avx2")))
+static inline __m256i Dau_CanonSwapAvx2( __m256i g, __m256i Mask0, __m256i Mask1, __m256i Mask2, __m128i Shift )
+{
+    __m256i t0 = _mm256_and_si256( g, Mask0 );
+    __m256i t1 = _mm256_sll_epi64( _mm256_and_si256(g, Mask1), Shift );
+    __m256i t2 = _mm256_srl_epi64( _mm256_and_si256(g, Mask2), Shift );
+    return _mm256_or_si256( t0, _mm256_or_si256(t1, t2) );
+}
+__attribute__((target("avx2")))
+static int Dau_CanonExpandAvx2( word * pG, word * pC, int nCands, int k, int nVars, word * pGNew, word * pCNew, int nCap )
+{
+    int q, i, b, Lanes, nNew = 0, KeyShift = 64 - (2 << k), nCands4 = nCands & ~3;
+    __m128i CountKey = _mm_cvtsi32_si128( KeyShift );
+    __m256i Mask0 = _mm256_setzero_si256(), Mask1 = Mask0, Mask2 = Mask0, MaskC = Mask0, Key, Min, g, c, x;
+    __m128i Shift = _mm_setzero_si128(), ShiftC = Shift;
+    word pStoreG[4], pStoreC[4], g64, KeyMin = ~(word)0;
+    // find the smallest key
+    Min = _mm256_set1_epi64x( (long long)0xFFFFFFFF );
+    for ( q = k; q < nVars; q++ )
+    {
+        if ( q > k )
+        {
+            word * s_PMasks = s_PPMasks[k][q];
+            Mask0 = _mm256_set1_epi64x( (long long)s_PMasks[0] );
+            Mask1 = _mm256_set1_epi64x( (long long)s_PMasks[1] );
+            Mask2 = _mm256_set1_epi64x( (long long)s_PMasks[2] );
+            Shift = _mm_cvtsi32_si128( (1 << q) - (1 << k) );
+        }
+        for ( i = 0; i < nCands4; i += 4 )
+        {
+            g   = _mm256_loadu_si256( (__m256i *)(pG + i) );
+            if ( q > k )
+                g = Dau_CanonSwapAvx2( g, Mask0, Mask1, Mask2, Shift );
+            Key = _mm256_srl_epi64( g, CountKey );
+            Min = _mm256_blendv_epi8( Min, Key, _mm256_cmpgt_epi64(Min, Key) );
+        }
+        for ( ; i < nCands; i++ )
+        {
+            g64 = q == k ? pG[i] : Abc_Tt6SwapVars( pG[i], k, q );
+            KeyMin = Abc_MinWord( KeyMin, g64 >> KeyShift );
+        }
+    }
+    _mm256_storeu_si256( (__m256i *)pStoreG, Min );
+    for ( b = 0; b < 4; b++ )
+        KeyMin = Abc_MinWord( KeyMin, pStoreG[b] );
+    // collect the children with the smallest key
+    Min = _mm256_set1_epi64x( (long long)KeyMin );
+    for ( q = k; q < nVars; q++ )
+    {
+        if ( q > k )
+        {
+            word * s_PMasks = s_PPMasks[k][q];
+            Mask0  = _mm256_set1_epi64x( (long long)s_PMasks[0] );
+            Mask1  = _mm256_set1_epi64x( (long long)s_PMasks[1] );
+            Mask2  = _mm256_set1_epi64x( (long long)s_PMasks[2] );
+            Shift  = _mm_cvtsi32_si128( (1 << q) - (1 << k) );
+            MaskC  = _mm256_set1_epi64x( (long long)(((word)0xF << (4*k)) | ((word)1 << (32+4*k))) );
+            ShiftC = _mm_cvtsi32_si128( 4 * (q - k) );
+        }
+        for ( i = 0; i < nCands4; i += 4 )
+        {
+            g   = _mm256_loadu_si256( (__m256i *)(pG + i) );
+            if ( q > k )
+                g = Dau_CanonSwapAvx2( g, Mask0, Mask1, Mask2, Shift );
+            Key = _mm256_srl_epi64( g, CountKey );
+            Lanes = _mm256_movemask_pd( _mm256_castsi256_pd(_mm256_cmpeq_epi64(Key, Min)) );
+            if ( Lanes == 0 )
+                continue;
+            c = _mm256_loadu_si256( (__m256i *)(pC + i) );
+            if ( q > k )
+            {
+                x = _mm256_and_si256( _mm256_xor_si256(_mm256_srl_epi64(c, ShiftC), c), MaskC );
+                c = _mm256_xor_si256( c, _mm256_xor_si256(x, _mm256_sll_epi64(x, ShiftC)) );
+            }
+            _mm256_storeu_si256( (__m256i *)pStoreG, g );
+            _mm256_storeu_si256( (__m256i *)pStoreC, c );
+            for ( b = 0; b < 4; b++ )
+            {
+                if ( !((Lanes >> b) & 1) )
+                    continue;
+                if ( nNew == nCap )
+                    return -1;
+                pGNew[nNew]   = pStoreG[b];
+                pCNew[nNew++] = pStoreC[b];
+            }
+        }
+        for ( ; i < nCands; i++ )
+        {
+            g64 = q == k ? pG[i] : Abc_Tt6SwapVars( pG[i], k, q );
+            if ( (g64 >> KeyShift) != KeyMin )
+                continue;
+            if ( nNew == nCap )
+                return -1;
+            pGNew[nNew]   = g64;
+            pCNew[nNew++] = q == k ? pC[i] : Dau_CanonSwapConfig( pC[i], k, q );
+        }
+    }
+    return nNew;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the name of the canonization kernel.]
+
+  Description [Kernels are numbered from 0 (portable 64-bit code)
+  to 1 (AVX2). Returns NULL if the kernel does not exist.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+char * Abc_TtCanonicizeExactKernelName( int iKernel )
+{
+    if ( iKernel == 0 )
+        return "word64";
+    if ( iKernel == 1 )
+        return "avx2";
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns the kernel if it is supported by this CPU.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Dau_CanonExpandFunc_t Dau_CanonKernel( int iKernel )
+{
+    if ( iKernel == 0 )
+        return Dau_CanonExpandWord64;
+#ifdef DAU_CANON_USE_X86
+    __builtin_cpu_init();
+    if ( iKernel == 1 && __builtin_cpu_supports("avx2") )
+        return Dau_CanonExpandAvx2;
+#endif
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Selects the canonization kernel for the calling thread.]
+
+  Description [If iKernel is -1, selects the widest kernel supported
+  by this CPU. Returns the number of the selected kernel, or -1 if the
+  requested kernel is not supported (in which case nothing changes).]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Abc_TtCanonicizeExactKernelSelect( int iKernel )
+{
+    Dau_CanonExpandFunc_t pFunc;
+    if ( iKernel == -1 )
+    {
+        for ( iKernel = 1; iKernel > 0; iKernel-- )
+            if ( Dau_CanonKernel(iKernel) )
+                break;
+    }
+    pFunc = Dau_CanonKernel( iKernel );
+    if ( pFunc == NULL )
+        return -1;
+    s_CanonExpandFunc = pFunc;
+    return iKernel;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the candidates with duplicated truth tables.]
+
+  Description [Such candidates have the same completions, so only the
+  first one is kept. The table should have room for the smallest power
+  of 2, which is not less than 2*nCands.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dau_CanonDedup( word * pG, word * pC, int nCands, int * pTable )
+{
+    int i, k, h, Mask, nNew = 0;
+    if ( nCands <= 16 )
+    {
+        for ( i = 0; i < nCands; i++ )
+        {
+            for ( k = 0; k < nNew; k++ )
+                if ( pG[k] == pG[i] )
+                    break;
+            if ( k < nNew )
+                continue;
+            pG[nNew]   = pG[i];
+            pC[nNew++] = pC[i];
+        }
+        return nNew;
+    }
+    for ( Mask = 1; Mask < 2 * nCands; Mask <<= 1 );
+    memset( pTable, 0xFF, sizeof(int) * Mask-- );
+    for ( i = 0; i < nCands; i++ )
+    {
+        for ( h = (int)((pG[i] * ABC_CONST(0x9E3779B97F4A7C15)) >> 40) & Mask; pTable[h] >= 0; h = (h + 1) & Mask )
+            if ( pG[pTable[h]] == pG[i] )
+                break;
+        if ( pTable[h] >= 0 )
+            continue;
+        pTable[h]  = nNew;
+        pG[nNew]   = pG[i];
+        pC[nNew++] = pC[i];
+    }
+    return nNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Finds a small truth table in the NPN class.]
+
+  Description [Performs local search by flipping the inputs and the output,
+  and by swapping the adjacent inputs, while the truth table decreases.
+  The result is used to prune the candidates of the exact search.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static word Dau_CanonUpperBound( word t, int nVars )
+{
+    word g;
+    int i, fChange = 1;
+    t = Abc_MinWord( t, ~t );
+    while ( fChange )
+    {
+        fChange = 0;
+        for ( i = 0; i < nVars; i++ )
+        {
+            g = Abc_Tt6Flip( t, i );
+            g = Abc_MinWord( g, ~g );
+            if ( g < t )
+                t = g, fChange = 1;
+        }
+        for ( i = 0; i < nVars - 1; i++ )
+        {
+            g = Abc_Tt6SwapAdjacent( t, i );
+            if ( g < t )
+                t = g, fChange = 1;
+        }
+    }
+    return t & Abc_Tt6Mask( 1 << nVars );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Removes the candidates that cannot lead to the smallest truth table.]
+
+  Description [The candidates have positions 0, 1, ..., nFixed-1 fixed.
+  The other variables can only be permuted, so a minterm, in which w of them
+  are equal to 1, ends up at least in position (m & (2^nFixed-1)) +
+  (2^w-1) * 2^nFixed. If this bound exceeds the most significant 1 in
+  the smallest transformation of the function seen so far (including
+  the candidates themselves), the candidate cannot lead to the smallest
+  truth table. This complements the pruning by the most significant bits,
+  which is not effective for the functions with few minterms.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dau_CanonPrune( word * pG, word * pC, int nCands, int nFixed, int nVars, word * pBest )
+{
+    word Mask = Abc_Tt6Mask( 1 << nVars ), x, y;
+    int i, w, s, Bound, nNew = 0;
+    for ( i = 0; i < nCands; i++ )
+        *pBest = Abc_MinWord( *pBest, pG[i] & Mask );
+    Bound = Abc_Tt6LastBit( *pBest );
+    for ( i = 0; i < nCands; i++ )
+    {
+        x = pG[i] & Mask;
+        if ( x )
+        {
+            for ( w = nVars - nFixed; !(x & s_CanonWeightMasks[nFixed][w]); w-- );
+            y = x & s_CanonWeightMasks[nFixed][w];
+            for ( s = nFixed; s < nVars; s++ )
+                y |= y >> (1 << s);
+            if ( (((1 << w) - 1) << nFixed) + Abc_Tt6LastBit(y & Abc_Tt6Mask(1 << nFixed)) > Bound )
+                continue;
+        }
+        pG[nNew]   = pG[i];
+        pC[nNew++] = pC[i];
+    }
+    return nNew;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Computes the smallest truth table in the NPN class.]
+
+  Description [The candidates are derived by applying all input phase
+  assignments (the output phase is chosen to make the most significant
+  bit equal to 0). Next, the positions are fixed one by one, starting
+  from position 0, which determines the most significant bits of the
+  truth table. After each step, the candidates are pruned and merged.
+  Returns 0 if the candidates did not fit into the buffers.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static int Dau_CanonExact( word t, int nVars, word * pBufs[4], int * pTable, int nCap, word * pConfig )
+{
+    word * pG = pBufs[0], * pC = pBufs[1], * pGNew = pBufs[2], * pCNew = pBufs[3], * pTemp;
+    word Config = 0, Best = Dau_CanonUpperBound( t, nVars );
+    int i, k, m, iVar, iBest, nCands = 0;
+    for ( i = 0; i < nVars; i++ )
+        Config |= (word)i << (4*i);
+    // consider the input phase assignments in the Gray code order
+    for ( m = 0; m < (1 << nVars); m++ )
+    {
+        if ( m > 0 )
+        {
+            for ( iVar = 0; !((m >> iVar) & 1); iVar++ );
+            t = Abc_Tt6Flip( t, iVar );
+            Config ^= (word)1 << (32+4*iVar);
+        }
+        pG[nCands]   = (t >> 63) ? ~t : t;
+        pC[nCands++] = Config | ((t >> 63) << 60);
+    }
+    nCands = Dau_CanonPrune( pG, pC, nCands, 0, nVars, &Best );
+    nCands = Dau_CanonDedup( pG, pC, nCands, pTable );
+    // fix the positions
+    for ( k = 0; k < nVars - 1; k++ )
+    {
+        nCands = s_CanonExpandFunc( pG, pC, nCands, k, nVars, pGNew, pCNew, nCap );
+        if ( nCands == -1 )
+            return 0;
+        nCands = Dau_CanonPrune( pGNew, pCNew, nCands, k + 1, nVars, &Best );
+        nCands = Dau_CanonDedup( pGNew, pCNew, nCands, pTable );
+        pTemp = pG; pG = pGNew; pGNew = pTemp;
+        pTemp = pC; pC = pCNew; pCNew = pTemp;
+    }
+    // the last position is fixed, choose the smallest truth table
+    for ( iBest = 0, i = 1; i < nCands; i++ )
+        if ( pG[i] < pG[iBest] )
+            iBest = i;
+    pConfig[0] = pC[iBest];
+    pConfig[1] = pG[iBest];
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Exact NPN canonization for up to 6 inputs.]
+
+  Description [Replaces the truth table by the smallest truth table in
+  its NPN class and returns the phase. Similar to Abc_TtCanonicize(), the
+  resulting truth table, permutation and phase can be used to restore
+  the original function by Abc_TtImplementNpnConfig(). The truth table
+  of less than 6 variables is stretched. Most of the time, there are
+  few candidates, which are stored on the stack. Otherwise, the heap
+  buffers of the largest size needed are used.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+unsigned Abc_TtCanonicizeExact( word * pTruth, int nVars, char * pCanonPerm )
+{
+    word pStore[4][DAU_CANON_CANDS], * pBufs[4], pConfig[2];
+    int pTable[2*DAU_CANON_CANDS];
+    unsigned uCanonPhase = 0;
+    int i;
+    assert( nVars >= 0 && nVars <= 6 );
+    if ( s_CanonExpandFunc == NULL )
+        Abc_TtCanonicizeExactKernelSelect( -1 );
+    for ( i = 0; i < 4; i++ )
+        pBufs[i] = pStore[i];
+    if ( !Dau_CanonExact( Abc_Tt6Stretch(pTruth[0], nVars), nVars, pBufs, pTable, DAU_CANON_CANDS, pConfig ) )
+    {
+        // the number of candidates does not exceed the size of the NPN class
+        int nCap = 2 << nVars, * pTableBig;
+        for ( i = 2; i <= nVars; i++ )
+            nCap *= i;
+        pTableBig = ABC_ALLOC( int, 4 * nCap );
+        pBufs[0]  = ABC_ALLOC( word, 4 * nCap );
+        for ( i = 1; i < 4; i++ )
+            pBufs[i] = pBufs[0] + i * nCap;
+        Dau_CanonExact( Abc_Tt6Stretch(pTruth[0], nVars), nVars, pBufs, pTableBig, nCap, pConfig );
+        ABC_FREE( pBufs[0] );
+        ABC_FREE( pTableBig );
+    }
+    for ( i = 0; i < nVars; i++ )
+    {
+        if ( pCanonPerm )
+            pCanonPerm[i] = (char)((pConfig[0] >> (4*i)) & 0xF);
+        uCanonPhase |= (unsigned)((pConfig[0] >> (32+4*i)) & 1) << i;
+    }
+    uCanonPhase |= (unsigned)((pConfig[0] >> 60) & 1) << nVars;
+    pTruth[0] = pConfig[1];
+    return uCanonPhase;
+}
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
+
@@ -58,6 +58,7 @@ struct Rwr_Man_t_
     unsigned short *   pMapInv;          // mapping of classes into functions
     char *             pPractical;       // practical NPN classes
     char **            pPerms4;          // four-var permutations
+    int                fShared;          // the library is borrowed from the one of this thread
     // node space
     Vec_Ptr_t *        vForest;          // all the nodes
     Rwr_Node_t **      pTable;           // the hash table of nodes by their canonical form
@@ -84,6 +85,7 @@ struct Rwr_Man_t_
     int                nScores[222];
     int                nCutsGood;
     int                nCutsBad;
+    int                nNodesReused;
     int                nSubgraphs;
     // runtime statistics
     abctime            timeStart;
@@ -140,6 +142,9 @@ extern int               Rwr_ManNodeVolume( Rwr_Man_t * p, Rwr_Node_t * p0, Rwr_
 extern void              Rwr_ManIncTravId( Rwr_Man_t * p );
 /*=== rwrMan.c ========================================================*/
 extern Rwr_Man_t *       Rwr_ManStart( int  fPrecompute );
+extern Rwr_Man_t *       Rwr_ManStartInt( int fPrecompute );
+extern void              Rwr_LibStart();
+extern void              Rwr_LibStop();
 extern void              Rwr_ManStop( Rwr_Man_t * p );
 extern void              Rwr_ManPrintStats( Rwr_Man_t * p );
 extern void              Rwr_ManPrintStatsFile( Rwr_Man_t * p );
@@ -29,6 +29,9 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+// the subgraph library of this thread (each thread derives its own copy)
+static ABC_THREAD_LOCAL Rwr_Man_t * s_RwrLib = NULL;
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -37,7 +40,14 @@ ABC_NAMESPACE_IMPL_START
 
   Synopsis    [Starts rewriting manager.]
 
-  Description []
+  Description [If fPrecompute is 0, the subgraph library is not derived
+  here but borrowed from the library of the current thread (see 
+  Rwr_LibStart), so that only the temporary storage is allocated for 
+  each call. The borrowed library is not read-only: rewriting records 
+  the scores (nScore, nGain, nAdded) in its nodes. This is safe because
+  the library is never shared across threads and the managers of one 
+  thread run one at a time; the scores are only meaningful between 
+  Rwr_ScoresClean() and Rwr_ScoresReport() in the same call.]
                
   SideEffects []
 
@@ -45,6 +55,52 @@ ABC_NAMESPACE_IMPL_START
 
 ***********************************************************************/
 Rwr_Man_t * Rwr_ManStart( int  fPrecompute )
+{
+    Rwr_Man_t * p;
+    abctime clk = Abc_Clock();
+    if ( fPrecompute )
+        return Rwr_ManStartInt( 1 );
+    Rwr_LibStart();
+    p = ABC_ALLOC( Rwr_Man_t, 1 );
+    memset( p, 0, sizeof(Rwr_Man_t) );
+    p->fShared    = 1;
+    // borrow the library
+    p->nFuncs     = s_RwrLib->nFuncs;
+    p->puCanons   = s_RwrLib->puCanons; 
+    p->pPhases    = s_RwrLib->pPhases; 
+    p->pPerms     = s_RwrLib->pPerms; 
+    p->pMap       = s_RwrLib->pMap; 
+    p->pMapInv    = s_RwrLib->pMapInv; 
+    p->pPractical = s_RwrLib->pPractical;
+    p->pPerms4    = s_RwrLib->pPerms4;
+    p->vForest    = s_RwrLib->vForest;
+    p->pTable     = s_RwrLib->pTable;
+    p->vClasses   = s_RwrLib->vClasses;
+    p->pMmNode    = s_RwrLib->pMmNode;
+    p->nClasses   = s_RwrLib->nClasses;
+    p->nTravIds   = s_RwrLib->nTravIds;
+    // temporary storage
+    p->vLevNums   = Vec_IntAlloc( 50 );
+    p->vFanins    = Vec_PtrAlloc( 50 );
+    p->vFaninsCur = Vec_PtrAlloc( 50 );
+    p->vNodesTemp = Vec_PtrAlloc( 50 );
+    p->timeStart  = Abc_Clock() - clk;
+    return p;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the complete rewriting manager.]
+
+  Description [Precomputes the subgraphs (fPrecompute = 1) or loads them
+  from the array compiled into the binary.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+Rwr_Man_t * Rwr_ManStartInt( int fPrecompute )
 {
     Dec_Man_t * pManDec;
     Rwr_Man_t * p;
@@ -108,6 +164,15 @@ p->timeStart = Abc_Clock() - clk;
 ***********************************************************************/
 void Rwr_ManStop( Rwr_Man_t * p )
 {
+    if ( p->fShared )
+    {
+        Vec_PtrFree( p->vNodesTemp );
+        Vec_IntFree( p->vLevNums );
+        Vec_PtrFree( p->vFanins );
+        Vec_PtrFree( p->vFaninsCur );
+        ABC_FREE( p );
+        return;
+    }
     if ( p->vClasses )
     {
         Rwr_Node_t * pNode;
@@ -149,6 +214,7 @@ void Rwr_ManPrintStats( Rwr_Man_t * p )
     printf( "Rewriting statistics:\n" );
     printf( "Total cuts tries  = %8d.\n", p->nCutsGood );
     printf( "Bad cuts found    = %8d.\n", p->nCutsBad );
+    printf( "Nodes w/ old cuts = %8d.\n", p->nNodesReused );
     printf( "Total subgraphs   = %8d.\n", p->nSubgraphs );
     printf( "Used NPN classes  = %8d.\n", Counter );
     printf( "Nodes considered  = %8d.\n", p->nNodesConsidered );
@@ -296,6 +362,44 @@ void Rwr_ManAddTimeTotal( Rwr_Man_t * p, abctime Time )
 }
 
 
+/**Function*************************************************************
+
+  Synopsis    [Starts the subgraph library of the current thread.]
+
+  Description [The library is derived from the built-in array once per 
+  thread and then borrowed by all calls to Rwr_ManStart(0) in this thread
+  until Rwr_LibStop() is called.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Rwr_LibStart()
+{
+    if ( s_RwrLib == NULL )
+        s_RwrLib = Rwr_ManStartInt( 0 );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Stops the subgraph library of the current thread.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Rwr_LibStop()
+{
+    if ( s_RwrLib == NULL )
+        return;
+    Rwr_ManStop( s_RwrLib );
+    s_RwrLib = NULL;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Precomputes AIG subgraphs.]
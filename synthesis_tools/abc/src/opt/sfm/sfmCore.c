@@ -20,6 +20,17 @@
 
 #include "sfmInt.h"
 
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
 ABC_NAMESPACE_IMPL_START
 
 
@@ -27,6 +38,44 @@ ABC_NAMESPACE_IMPL_START
 ///                        DECLARATIONS                              ///
 ////////////////////////////////////////////////////////////////////////
 
+#define SFM_PAR_THR_MAX  100   // the max number of threads
+#define SFM_PAR_CHUNK      4   // the number of nodes taken by a thread at a time
+#define SFM_PAR_BATCH    256   // the number of nodes whose windows are evaluated together
+
+#ifdef ABC_USE_PTHREADS
+
+typedef struct Sfm_ParRes_t_ Sfm_ParRes_t;
+struct Sfm_ParRes_t_
+{
+    int              fEval;          // the node was evaluated
+    int              fChange;        // the change was found
+    int              iFanin;         // the fanin to be replaced
+    int              iDiv;           // the new fanin (-1 if the fanin is removed)
+    word             uTruth;         // the new function of the node
+    Vec_Int_t *      vWin;           // the objects of the window
+};
+
+typedef struct Sfm_ParShare_t_ Sfm_ParShare_t;
+struct Sfm_ParShare_t_
+{
+    Vec_Int_t *      vNodes;         // the nodes to be resynthesized
+    int              iBeg;           // the first node of the current batch
+    int              nNodes;         // the number of nodes in the current batch
+    Sfm_ParRes_t *   pRes;           // the outcomes for the nodes of the batch
+    int              iNext;          // the next node to be processed
+    pthread_mutex_t  Mutex;          // protects iNext
+};
+
+typedef struct Sfm_ParThData_t_ Sfm_ParThData_t;
+struct Sfm_ParThData_t_
+{
+    Sfm_ParShare_t * pShare;         // the shared data
+    Sfm_Ntk_t *      pNtk;           // the manager of this thread
+    Sfm_Par_t        Pars;           // the parameters of this thread
+};
+
+#endif
+
 ////////////////////////////////////////////////////////////////////////
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
@@ -51,6 +100,7 @@ void Sfm_ParSetDefault( Sfm_Par_t * pPars )
     pPars->nWinSizeMax  =  300;  // the maximum window size
     pPars->nGrowthLevel =    0;  // the maximum allowed growth in level
     pPars->nBTLimit     = 5000;  // the maximum number of conflicts in one SAT run
+    pPars->nProcs       =    1;  // the number of threads used to evaluate windows
     pPars->fRrOnly      =    0;  // perform redundancy removal
     pPars->fArea        =    0;  // performs optimization for area
     pPars->fMoreEffort  =    0;  // performs high-affort minimization
@@ -81,6 +131,11 @@ void Sfm_NtkPrintStats( Sfm_Ntk_t * p )
     printf( "Resub  %6d out of %6d (%6.2f %%)   ", p->nResubs,  p->nTryResubs,  100.0*p->nResubs /Abc_MaxInt(1, p->nTryResubs)  );
     printf( "\n" );
 
+    // each rejected candidate would take at least two SAT calls (for the onset and offset patterns)
+    printf( "Simulation:  " );
+    printf( "Rejected %6d candidates   SAT calls avoided %6d out of %6d (%6.2f %%)   ", p->nSimRejects, 2*p->nSimRejects, 2*p->nSimRejects + p->nSatCalls, 100.0*2*p->nSimRejects/Abc_MaxInt(1, 2*p->nSimRejects + p->nSatCalls) );
+    printf( "\n" );
+
     printf( "Reduction:   " );
     printf( "Nodes  %6d out of %6d (%6.2f %%)   ", p->nTotalNodesBeg-p->nTotalNodesEnd, p->nTotalNodesBeg, 100.0*(p->nTotalNodesBeg-p->nTotalNodesEnd)/Abc_MaxInt(1, p->nTotalNodesBeg) );
     printf( "Edges  %6d out of %6d (%6.2f %%)   ", p->nTotalEdgesBeg-p->nTotalEdgesEnd, p->nTotalEdgesBeg, 100.0*(p->nTotalEdgesBeg-p->nTotalEdgesEnd)/Abc_MaxInt(1, p->nTotalEdgesBeg) );
@@ -124,22 +179,28 @@ int Sfm_NodeResubSolve( Sfm_Ntk_t * p, int iNode, int f, int fRemoveOnly )
     // clean simulation info
     p->nCexes = 0;
     Vec_WrdFill( p->vDivCexes, Vec_IntSize(p->vDivs), 0 );
+    Vec_IntFill( p->vDivRejs, Vec_IntSize(p->vDivs), 0 );
     // try removing the critical fanin
     Vec_IntClear( p->vDivIds );
     Sfm_ObjForEachFanin( p, iNode, iFanin, i )
         if ( i != f )
             Vec_IntPush( p->vDivIds, Sfm_ObjSatVar(p, iFanin) );
+    if ( !Sfm_NtkSimCheck( p, iNode, f, -1 ) )
+        p->nSimRejects++;
+    else
+    {
 clk = Abc_Clock();
-    uTruth = Sfm_ComputeInterpolant( p );
+        uTruth = Sfm_ComputeInterpolant( p );
 p->timeSat += Abc_Clock() - clk;
-    // analyze outcomes
-    if ( uTruth == SFM_SAT_UNDEC )
-    {
-        p->nTimeOuts++;
-        return 0;
+        // analyze outcomes
+        if ( uTruth == SFM_SAT_UNDEC )
+        {
+            p->nTimeOuts++;
+            return 0;
+        }
+        if ( uTruth != SFM_SAT_SAT )
+            goto finish;
     }
-    if ( uTruth != SFM_SAT_SAT )
-        goto finish;
     if ( fRemoveOnly || p->pPars->fRrOnly || Vec_IntSize(p->vDivs) == 0 )
         return 0;
 
@@ -162,10 +223,16 @@ p->timeSat += Abc_Clock() - clk;
             printf( "\n" );
         }
         // find the next divisor to try
-        uMask = (~(word)0) >> (64 - p->nCexes);
+        uMask = p->nCexes ? (~(word)0) >> (64 - p->nCexes) : 0;
         Vec_WrdForEachEntry( p->vDivCexes, uSign, iVar )
-            if ( uSign == uMask )
+        {
+            if ( uSign != uMask || Vec_IntEntry(p->vDivRejs, iVar) )
+                continue;
+            if ( Sfm_NtkSimCheck( p, iNode, f, Vec_IntEntry(p->vDivs, iVar) ) )
                 break;
+            Vec_IntWriteEntry( p->vDivRejs, iVar, 1 );
+            p->nSimRejects++;
+        }
         if ( iVar == Vec_IntSize(p->vDivs) )
             return 0;
         // try replacing the critical fanin
@@ -202,6 +269,14 @@ finish:
         p->nResubs++;
     if ( fSkipUpdate )
         return 0;
+    // record the change to be performed by the main thread
+    if ( p->fDelayUpdate )
+    {
+        p->iUpdFanin = f;
+        p->iUpdDiv   = (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar));
+        p->uUpdTruth = uTruth;
+        return 1;
+    }
     // update the network
     Sfm_NtkUpdate( p, iNode, f, (iVar == -1 ? iVar : Vec_IntEntry(p->vDivs, iVar)), uTruth );
     return 1;
@@ -244,6 +319,327 @@ int Sfm_NodeResub( Sfm_Ntk_t * p, int iNode )
     return 0;
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the node should be resynthesized.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sfm_NodeIsCandidate( Sfm_Ntk_t * p, int iNode )
+{
+    if ( Sfm_ObjIsFixed( p, iNode ) )
+        return 0;
+    if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, iNode) > p->pPars->nDepthMax )
+        return 0;
+    if ( Sfm_ObjFaninNum(p, iNode) < 2 || Sfm_ObjFaninNum(p, iNode) > 6 )
+        return 0;
+    return 1;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if windows can be evaluated using several threads.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkPerformParCheck( Sfm_Ntk_t * p )
+{
+#ifdef ABC_USE_PTHREADS
+    return p->pPars->nProcs > 1;
+#else
+    return 0;
+#endif
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Creates the manager used by one thread.]
+
+  Description [The network (fanins, fanouts, levels, truth tables and
+  CNFs) is shared with the main manager and is only read by the thread.
+  The traversal IDs, the fanin counters, the SAT variable maps, the
+  window and the SAT solver are private. The changes found are recorded
+  in the manager instead of being performed.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Sfm_Ntk_t * Sfm_NtkDupWorker( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
+{
+    Sfm_Ntk_t * pNew = ABC_CALLOC( Sfm_Ntk_t, 1 );
+    pNew->pPars     = pPars;
+    pNew->nPis      = p->nPis;
+    pNew->nPos      = p->nPos;
+    pNew->nNodes    = p->nNodes;
+    pNew->nObjs     = p->nObjs;
+    pNew->vFixed    = p->vFixed;
+    pNew->vEmpty    = p->vEmpty;
+    pNew->vTruths   = p->vTruths;
+    pNew->vFanins   = p->vFanins;
+    pNew->vFanouts  = p->vFanouts;
+    pNew->vLevels   = p->vLevels;
+    pNew->vLevelsR  = p->vLevelsR;
+    pNew->vCnfs     = p->vCnfs;
+    Vec_IntFill( &pNew->vCounts,   p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds,  p->nObjs,  0 );
+    Vec_IntFill( &pNew->vTravIds2, p->nObjs,  0 );
+    Vec_IntFill( &pNew->vId2Var,   2*p->nObjs, -1 );
+    Vec_IntFill( &pNew->vVar2Id,   2*p->nObjs, -1 );
+    Sfm_NtkPrepare( pNew );
+    pNew->nLevelMax = p->nLevelMax;
+    pNew->fDelayUpdate = 1;
+    return pNew;
+}
+static void Sfm_NtkFreeWorker( Sfm_Ntk_t * p )
+{
+    ABC_FREE( p->vCounts.pArray );
+    ABC_FREE( p->vTravIds.pArray );
+    ABC_FREE( p->vTravIds2.pArray );
+    ABC_FREE( p->vId2Var.pArray );
+    ABC_FREE( p->vVar2Id.pArray );
+    Vec_IntFreeP( &p->vNodes );
+    Vec_IntFreeP( &p->vDivs  );
+    Vec_IntFreeP( &p->vRoots );
+    Vec_IntFreeP( &p->vTfo   );
+    Vec_WrdFreeP( &p->vDivCexes );
+    Vec_WrdFreeP( &p->vSims );
+    Vec_IntFreeP( &p->vDivRejs );
+    Vec_IntFreeP( &p->vOrder );
+    Vec_IntFreeP( &p->vDivVars );
+    Vec_IntFreeP( &p->vDivIds );
+    Vec_IntFreeP( &p->vLits  );
+    Vec_IntFreeP( &p->vValues );
+    Vec_WecFreeP( &p->vClauses );
+    Vec_IntFreeP( &p->vFaninMap );
+    if ( p->pSat  ) sat_solver_delete( p->pSat );
+    ABC_FREE( p );
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the window of one node.]
+
+  Description [Records the change found, if any, together with the 
+  objects whose structure the outcome depends on.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Sfm_NtkPerformParNode( Sfm_Ntk_t * p, int iNode, Sfm_ParRes_t * pRes )
+{
+    pRes->fEval   = Sfm_NodeIsCandidate( p, iNode );
+    pRes->fChange = 0;
+    Vec_IntClear( pRes->vWin );
+    if ( !pRes->fEval )
+        return;
+    pRes->fChange = Sfm_NodeResub( p, iNode );
+    // the window contains the TFI cones of all its nodes (otherwise, only the collected part of the TFI)
+    Vec_IntAppend( pRes->vWin, Vec_IntSize(p->vOrder) ? p->vOrder : p->vNodes );
+    if ( !pRes->fChange )
+        return;
+    pRes->iFanin = p->iUpdFanin;
+    pRes->iDiv   = p->iUpdDiv;
+    pRes->uTruth = p->uUpdTruth;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Evaluates the windows of the nodes taken from the batch.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void * Sfm_NtkPerformParThread( void * pArg )
+{
+    Sfm_ParThData_t * pThData = (Sfm_ParThData_t *)pArg;
+    Sfm_ParShare_t * pShare = pThData->pShare;
+    int i, iStart, iStop;
+    while ( 1 )
+    {
+        pthread_mutex_lock( &pShare->Mutex );
+        iStart = pShare->iNext;
+        pShare->iNext += SFM_PAR_CHUNK;
+        pthread_mutex_unlock( &pShare->Mutex );
+        if ( iStart >= pShare->nNodes )
+            break;
+        iStop = Abc_MinInt( iStart + SFM_PAR_CHUNK, pShare->nNodes );
+        for ( i = iStart; i < iStop; i++ )
+            Sfm_NtkPerformParNode( pThData->pNtk, Vec_IntEntry(pShare->vNodes, pShare->iBeg + i), pShare->pRes + i );
+    }
+    return NULL;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Returns 1 if the window was changed in the current batch.]
+
+  Description []
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline int Sfm_NtkWindowIsChanged( Sfm_Ntk_t * p, Vec_Int_t * vWin )
+{
+    int i, iObj;
+    Vec_IntForEachEntry( vWin, iObj, i )
+        if ( Vec_IntEntry(p->vStamps, iObj) == p->iStamp )
+            return 1;
+    return 0;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Performs resubstitution using several threads.]
+
+  Description [The nodes are processed in batches of consecutive nodes. 
+  The windows of the nodes in a batch are computed and solved concurrently
+  against the network at the beginning of the batch, with each thread 
+  using its own manager. Then the main thread visits the nodes of the batch 
+  in order, performs the changes found and marks the objects changed. If 
+  the window of a node with a change contains a changed object, the change 
+  may be invalid and the node is resynthesized again by the main thread. 
+  Since the TFI cones of window nodes are included in the window, a change 
+  is only performed if the logic it was derived from is the same. A node 
+  without a change is not revisited, similar to the nodes changed later 
+  in the sequential flow. The result does not depend on the number of 
+  threads.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkPerformPar( Sfm_Ntk_t * p )
+{
+    pthread_t WorkerThread[SFM_PAR_THR_MAX];
+    Sfm_ParThData_t ThData[SFM_PAR_THR_MAX];
+    Sfm_ParShare_t Share, * pShare = &Share;
+    Sfm_ParRes_t * pRes, * pResAll;
+    Vec_Int_t * vNodes;
+    int nProcs = Abc_MinInt( p->pPars->nProcs, SFM_PAR_THR_MAX );
+    int i, k, n, iNode, status, Counter = 0, nReused = 0, nRedone = 0;
+    // collect the nodes
+    vNodes = Vec_IntAlloc( p->nNodes );
+    Sfm_NtkForEachNode( p, i )
+        if ( !Sfm_ObjIsFixed( p, i ) )
+            Vec_IntPush( vNodes, i );
+    // start the managers of the threads
+    memset( pShare, 0, sizeof(Sfm_ParShare_t) );
+    pShare->vNodes = vNodes;
+    pShare->pRes   = pResAll = ABC_CALLOC( Sfm_ParRes_t, SFM_PAR_BATCH );
+    for ( k = 0; k < SFM_PAR_BATCH; k++ )
+        pResAll[k].vWin = Vec_IntAlloc( 100 );
+    status = pthread_mutex_init( &pShare->Mutex, NULL );  assert( status == 0 );
+    for ( k = 0; k < nProcs; k++ )
+    {
+        ThData[k].pShare = pShare;
+        ThData[k].Pars   = *p->pPars;
+        // detailed printouts are not thread-safe
+        ThData[k].Pars.fVeryVerbose = 0;
+        ThData[k].pNtk   = Sfm_NtkDupWorker( p, &ThData[k].Pars );
+    }
+    p->vStamps = Vec_IntStart( p->nObjs );
+    for ( pShare->iBeg = 0; pShare->iBeg < Vec_IntSize(vNodes); pShare->iBeg += SFM_PAR_BATCH )
+    {
+        // evaluate the windows (the main thread is used as the last worker)
+        pShare->nNodes = Abc_MinInt( SFM_PAR_BATCH, Vec_IntSize(vNodes) - pShare->iBeg );
+        pShare->iNext  = 0;
+        for ( k = 0; k < nProcs - 1; k++ )
+        {
+            status = pthread_create( WorkerThread + k, NULL, Sfm_NtkPerformParThread, (void *)(ThData + k) );  
+            assert( status == 0 );
+        }
+        Sfm_NtkPerformParThread( (void *)(ThData + nProcs - 1) );
+        for ( k = 0; k < nProcs - 1; k++ )
+        {
+            status = pthread_join( WorkerThread[k], NULL );  
+            assert( status == 0 );
+        }
+        // perform the changes in the order of nodes
+        p->iStamp++;
+        for ( i = 0; i < pShare->nNodes; i++ )
+        {
+            pRes  = pResAll + i;
+            iNode = Vec_IntEntry( vNodes, pShare->iBeg + i );
+            if ( !Sfm_NodeIsCandidate( p, iNode ) )
+                continue;
+            n = 0;
+            if ( pRes->fEval && (!pRes->fChange || !Sfm_NtkWindowIsChanged(p, pRes->vWin)) )
+            {
+                nReused++;
+                if ( !pRes->fChange )
+                    continue;
+                if ( pRes->iDiv == -1 )
+                    p->nRemoves++;
+                else
+                    p->nResubs++;
+                Sfm_NtkUpdate( p, iNode, pRes->iFanin, pRes->iDiv, pRes->uTruth );
+                n++;
+            }
+            else
+                nRedone++;
+            for ( ; Sfm_NodeResub(p, iNode); n++ )
+                ;
+            Counter += (n > 0);
+            if ( p->pPars->nNodesMax && Counter >= p->pPars->nNodesMax )
+                break;
+        }
+        if ( i < pShare->nNodes )
+            break;
+    }
+    // collect statistics
+    for ( k = 0; k < nProcs; k++ )
+    {
+        Sfm_Ntk_t * pNtk = ThData[k].pNtk;
+        p->nNodesTried += pNtk->nNodesTried;
+        p->nTotalDivs  += pNtk->nTotalDivs;
+        p->nSatCalls   += pNtk->nSatCalls;
+        p->nTimeOuts   += pNtk->nTimeOuts;
+        p->nMaxDivs    += pNtk->nMaxDivs;
+        p->nTryRemoves += pNtk->nTryRemoves;
+        p->nTryResubs  += pNtk->nTryResubs;
+        p->nSimRejects += pNtk->nSimRejects;
+        Sfm_NtkFreeWorker( pNtk );
+    }
+    if ( p->pPars->fVerbose )
+        printf( "Evaluated windows using %d threads:  Reused = %d.  Redone = %d.\n", nProcs, nReused, nRedone );
+    for ( k = 0; k < SFM_PAR_BATCH; k++ )
+        Vec_IntFree( pResAll[k].vWin );
+    ABC_FREE( pResAll );
+    Vec_IntFreeP( &p->vStamps );
+    Vec_IntFree( vNodes );
+    pthread_mutex_destroy( &pShare->Mutex );
+    return Counter;
+}
+
+#else
+
+int Sfm_NtkPerformPar( Sfm_Ntk_t * p ) { return 0; }
+
+#endif
+
 /**Function*************************************************************
 
   Synopsis    []
@@ -272,22 +668,23 @@ int Sfm_NtkPerform( Sfm_Ntk_t * p, Sfm_Par_t * pPars )
 //    return 0;
     p->nTotalNodesBeg = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesBeg = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
-    Sfm_NtkForEachNode( p, i )
+    if ( Sfm_NtkPerformParCheck( p ) )
+        Counter = Sfm_NtkPerformPar( p );
+    else
     {
-        if ( Sfm_ObjIsFixed( p, i ) )
-            continue;
-        if ( p->pPars->nDepthMax && Sfm_ObjLevel(p, i) > p->pPars->nDepthMax )
-            continue;
-        if ( Sfm_ObjFaninNum(p, i) < 2 || Sfm_ObjFaninNum(p, i) > 6 )
-            continue;
-        for ( k = 0; Sfm_NodeResub(p, i); k++ )
+        Sfm_NtkForEachNode( p, i )
         {
-//            Counter++;
-//            break;
+            if ( !Sfm_NodeIsCandidate( p, i ) )
+                continue;
+            for ( k = 0; Sfm_NodeResub(p, i); k++ )
+            {
+//                Counter++;
+//                break;
+            }
+            Counter += (k > 0);
+            if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
+                break;
         }
-        Counter += (k > 0);
-        if ( pPars->nNodesMax && Counter >= pPars->nNodesMax )
-            break;
     }
     p->nTotalNodesEnd = Vec_WecSizeUsedLimits( &p->vFanins, Sfm_NtkPiNum(p), Vec_WecSize(&p->vFanins) - Sfm_NtkPoNum(p) );
     p->nTotalEdgesEnd = Vec_WecSizeSize(&p->vFanins) - Sfm_NtkPoNum(p);
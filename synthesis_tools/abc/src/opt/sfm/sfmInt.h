@@ -56,6 +56,8 @@ ABC_NAMESPACE_HEADER_START
 #define SFM_WIN_MAX   1000
 #define SFM_DEC_MAX   4
 #define SFM_SIM_WORDS 8
+#define SFM_WIN_WORDS 4
+#define SFM_WIN_RAND  2
 
 ////////////////////////////////////////////////////////////////////////
 ///                         BASIC TYPES                              ///
@@ -111,6 +113,11 @@ struct Sfm_Ntk_t_
     // counter-examples
     int               nCexes;      // number of CEXes
     Vec_Wrd_t *       vDivCexes;   // counter-examples
+    // simulation
+    Vec_Wrd_t *       vSims;       // simulation info of SAT variables
+    word              pSimCare[SFM_WIN_WORDS]; // patterns where the node is observable
+    int               nSimCexes;   // the number of counter-examples in the simulation info
+    Vec_Int_t *       vDivRejs;    // divisors rejected by simulation
     // intermediate data
     Vec_Int_t *       vOrder;      // object order
     Vec_Int_t *       vDivVars;    // divisor SAT variables
@@ -129,6 +136,14 @@ struct Sfm_Ntk_t_
     int               nSatCalls;
     int               nTimeOuts;
     int               nMaxDivs;
+    int               nSimRejects;
+    // parallel evaluation
+    int               fDelayUpdate; // record the change instead of performing it
+    int               iUpdFanin;   // the fanin to be replaced
+    int               iUpdDiv;     // the new fanin (-1 if the fanin is removed)
+    word              uUpdTruth;   // the new function of the node
+    Vec_Int_t *       vStamps;     // the last batch in which the object was changed
+    int               iStamp;      // the current batch
     // runtime
     abctime           timeWin;
     abctime           timeDiv;
@@ -173,6 +188,8 @@ static inline void Sfm_ObjSetLevel( Sfm_Ntk_t * p, int iObj, int Lev )  { Vec_In
 static inline int  Sfm_ObjLevelR( Sfm_Ntk_t * p, int iObj )             { return Vec_IntEntry( &p->vLevelsR, iObj );                        }
 static inline void Sfm_ObjSetLevelR( Sfm_Ntk_t * p, int iObj, int Lev ) { Vec_IntWriteEntry( &p->vLevelsR, iObj, Lev );                     }
 
+static inline void Sfm_ObjMarkChanged( Sfm_Ntk_t * p, int iObj )       { if ( p->vStamps ) Vec_IntWriteEntry(p->vStamps, iObj, p->iStamp); }
+
 static inline int  Sfm_ObjUpdateFaninCount( Sfm_Ntk_t * p, int iObj )   { return Vec_IntAddToEntry(&p->vCounts, iObj, -1);                  }
 static inline void Sfm_ObjResetFaninCount( Sfm_Ntk_t * p, int iObj )    { Vec_IntWriteEntry(&p->vCounts, iObj, Sfm_ObjFaninNum(p, iObj)-1); }
 
@@ -216,6 +233,7 @@ extern void         Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNe
 /*=== sfmSat.c ==========================================================*/
 extern int          Sfm_NtkWindowToSolver( Sfm_Ntk_t * p );
 extern word         Sfm_ComputeInterpolant( Sfm_Ntk_t * p );
+extern int          Sfm_NtkSimCheck( Sfm_Ntk_t * p, int iNode, int f, int iDiv );
 /*=== sfmTim.c ==========================================================*/
 extern Sfm_Tim_t *  Sfm_TimStart( Mio_Library_t * pLib, Scl_Con_t * pExt, Abc_Ntk_t * pNtk, int DeltaCrit );
 extern void         Sfm_TimStop( Sfm_Tim_t * p );
@@ -200,6 +200,8 @@ void Sfm_NtkPrepare( Sfm_Ntk_t * p )
     p->vRoots    = Vec_IntAlloc( 1000 );
     p->vTfo      = Vec_IntAlloc( 1000 );
     p->vDivCexes = Vec_WrdStart( p->pPars->nWinSizeMax );
+    p->vSims     = Vec_WrdAlloc( 1000 );
+    p->vDivRejs  = Vec_IntAlloc( 100 );
     p->vOrder    = Vec_IntAlloc( 100 );
     p->vDivVars  = Vec_IntAlloc( 100 );
     p->vDivIds   = Vec_IntAlloc( 1000 );
@@ -234,6 +236,8 @@ void Sfm_NtkFree( Sfm_Ntk_t * p )
     Vec_IntFreeP( &p->vRoots );
     Vec_IntFreeP( &p->vTfo   );
     Vec_WrdFreeP( &p->vDivCexes );
+    Vec_WrdFreeP( &p->vSims );
+    Vec_IntFreeP( &p->vDivRejs );
     Vec_IntFreeP( &p->vOrder );
     Vec_IntFreeP( &p->vDivVars );
     Vec_IntFreeP( &p->vDivIds );
@@ -265,6 +269,8 @@ void Sfm_NtkRemoveFanin( Sfm_Ntk_t * p, int iNode, int iFanin )
     assert( RetValue );
     RetValue = Vec_IntRemove( Sfm_ObjFoArray(p, iFanin), iNode );
     assert( RetValue );
+    Sfm_ObjMarkChanged( p, iNode );
+    Sfm_ObjMarkChanged( p, iFanin );
 }
 void Sfm_NtkAddFanin( Sfm_Ntk_t * p, int iNode, int iFanin )
 {
@@ -276,6 +282,8 @@ void Sfm_NtkAddFanin( Sfm_Ntk_t * p, int iNode, int iFanin )
     assert( Vec_IntFind( Sfm_ObjFoArray(p, iFanin), iNode ) == -1 );
     Vec_IntPush( Sfm_ObjFiArray(p, iNode), iFanin );
     Vec_IntPush( Sfm_ObjFoArray(p, iFanin), iNode );
+    Sfm_ObjMarkChanged( p, iNode );
+    Sfm_ObjMarkChanged( p, iFanin );
 }
 void Sfm_NtkDeleteObj_rec( Sfm_Ntk_t * p, int iNode )
 {
@@ -283,9 +291,11 @@ void Sfm_NtkDeleteObj_rec( Sfm_Ntk_t * p, int iNode )
     if ( Sfm_ObjFanoutNum(p, iNode) > 0 || Sfm_ObjIsPi(p, iNode) || Sfm_ObjIsFixed(p, iNode) )
         return;
     assert( Sfm_ObjIsNode(p, iNode) );
+    Sfm_ObjMarkChanged( p, iNode );
     Sfm_ObjForEachFanin( p, iNode, iFanin, i )
     {
         int RetValue = Vec_IntRemove( Sfm_ObjFoArray(p, iFanin), iNode );  assert( RetValue );
+        Sfm_ObjMarkChanged( p, iFanin );
         Sfm_NtkDeleteObj_rec( p, iFanin );
     }
     Vec_IntClear( Sfm_ObjFiArray(p, iNode) );
@@ -316,11 +326,13 @@ void Sfm_NtkUpdate( Sfm_Ntk_t * p, int iNode, int f, int iFaninNew, word uTruth
     int iFanin = Sfm_ObjFanin( p, iNode, f );
     assert( Sfm_ObjIsNode(p, iNode) );
     assert( iFanin != iFaninNew );
+    Sfm_ObjMarkChanged( p, iNode );
     if ( uTruth == 0 || ~uTruth == 0 )
     {
         Sfm_ObjForEachFanin( p, iNode, iFanin, f )
         {
             int RetValue = Vec_IntRemove( Sfm_ObjFoArray(p, iFanin), iNode );  assert( RetValue );
+            Sfm_ObjMarkChanged( p, iFanin );
             Sfm_NtkDeleteObj_rec( p, iFanin );
         }
         Vec_IntClear( Sfm_ObjFiArray(p, iNode) );
@@ -40,6 +40,187 @@ static word s_Truths6[6] = {
 ///                     FUNCTION DEFINITIONS                         ///
 ////////////////////////////////////////////////////////////////////////
 
+/**Function*************************************************************
+
+  Synopsis    [Simulation info of the window.]
+
+  Description [Each SAT variable of the window has SFM_WIN_WORDS words 
+  of simulation info. The first SFM_WIN_RAND words contain random 
+  patterns, the remaining words are filled with the satisfying 
+  assignments found by the SAT solver.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static inline word * Sfm_NtkSimVar( Sfm_Ntk_t * p, int iVar )           { return Vec_WrdEntryP( p->vSims, iVar * SFM_WIN_WORDS );  }
+static inline int    Sfm_NtkSimCexMax( Sfm_Ntk_t * p )                  { return 64 * (SFM_WIN_WORDS - SFM_WIN_RAND);              }
+
+// the random pattern depends only on the object, which makes the result independent of the order of windows
+static inline word Sfm_ObjSimRandom( int iObj, int w )
+{
+    word x = ((word)iObj << 8) + (word)w + ABC_CONST(0x9E3779B97F4A7C15);
+    x = (x ^ (x >> 30)) * ABC_CONST(0xBF58476D1CE4E5B9);
+    x = (x ^ (x >> 27)) * ABC_CONST(0x94D049BB133111EB);
+    return x ^ (x >> 31);
+}
+static inline word Sfm_ObjSimNode( word uTruth, int nFanins, word ** pSims, int w )
+{
+    word pCofs[64];
+    int i, k, n = 1 << nFanins;
+    for ( i = 0; i < n; i++ )
+        pCofs[i] = ((uTruth >> i) & 1) ? ~(word)0 : 0;
+    for ( k = 0; k < nFanins; k++, n >>= 1 )
+        for ( i = 0; i < n/2; i++ )
+            pCofs[i] = (pSims[k][w] & pCofs[2*i+1]) | (~pSims[k][w] & pCofs[2*i]);
+    return pCofs[0];
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Simulates the window using random patterns.]
+
+  Description [The first function simulates the nodes in p->vOrder, 
+  which is a topological order. The second function simulates the copy 
+  of the TFO, in which the node is complemented, and marks the patterns 
+  where one of the roots changes. The original variables of the roots 
+  are in p->vLits.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sfm_NtkWindowSimulate( Sfm_Ntk_t * p )
+{
+    word * pSims[SFM_FANIN_MAX], * pSim;
+    int i, k, w, iNode, iFanin;
+    Vec_WrdFill( p->vSims, (1 + Vec_IntSize(p->vOrder) + Vec_IntSize(p->vTfo)) * SFM_WIN_WORDS, 0 );
+    for ( w = 0; w < SFM_WIN_WORDS; w++ )
+        p->pSimCare[w] = w < SFM_WIN_RAND ? ~(word)0 : 0;
+    p->nSimCexes = 0;
+    Vec_IntForEachEntry( p->vOrder, iNode, i )
+    {
+        pSim = Sfm_NtkSimVar( p, Sfm_ObjSatVar(p, iNode) );
+        if ( Sfm_ObjIsPi(p, iNode) )
+        {
+            for ( w = 0; w < SFM_WIN_RAND; w++ )
+                pSim[w] = Sfm_ObjSimRandom( iNode, w );
+            continue;
+        }
+        assert( Sfm_ObjFaninNum(p, iNode) <= SFM_FANIN_MAX );
+        Sfm_ObjForEachFanin( p, iNode, iFanin, k )
+            pSims[k] = Sfm_NtkSimVar( p, Sfm_ObjSatVar(p, iFanin) );
+        for ( w = 0; w < SFM_WIN_RAND; w++ )
+            pSim[w] = Sfm_ObjSimNode( Vec_WrdEntry(p->vTruths, iNode), Sfm_ObjFaninNum(p, iNode), pSims, w );
+    }
+}
+void Sfm_NtkWindowSimulateTfo( Sfm_Ntk_t * p )
+{
+    word * pSims[SFM_FANIN_MAX], * pSim, * pSim0, pPivot[SFM_WIN_RAND];
+    int i, k, w, iNode, iFanin, nVars = Vec_IntSize(p->vOrder);
+    pSim = Sfm_NtkSimVar( p, Sfm_ObjSatVar(p, p->iPivotNode) );
+    for ( w = 0; w < SFM_WIN_RAND; w++ )
+        pPivot[w] = ~pSim[w];
+    // TFO nodes have new variables following those of p->vOrder
+    Vec_IntForEachEntry( p->vOrder, iNode, i )
+    {
+        if ( Sfm_ObjSatVar(p, iNode) <= nVars )
+            continue;
+        pSim = Sfm_NtkSimVar( p, Sfm_ObjSatVar(p, iNode) );
+        Sfm_ObjForEachFanin( p, iNode, iFanin, k )
+            pSims[k] = iFanin == p->iPivotNode ? pPivot : Sfm_NtkSimVar( p, Sfm_ObjSatVar(p, iFanin) );
+        for ( w = 0; w < SFM_WIN_RAND; w++ )
+            pSim[w] = Sfm_ObjSimNode( Vec_WrdEntry(p->vTruths, iNode), Sfm_ObjFaninNum(p, iNode), pSims, w );
+    }
+    for ( w = 0; w < SFM_WIN_RAND; w++ )
+        p->pSimCare[w] = 0;
+    Vec_IntForEachEntry( p->vRoots, iNode, i )
+    {
+        pSim0 = Sfm_NtkSimVar( p, Vec_IntEntry(p->vLits, i) );
+        pSim  = Sfm_NtkSimVar( p, Sfm_ObjSatVar(p, iNode) );
+        for ( w = 0; w < SFM_WIN_RAND; w++ )
+            p->pSimCare[w] |= pSim0[w] ^ pSim[w];
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Adds the current satisfying assignment to the simulation info.]
+
+  Description [Only the original variables of the window are recorded.
+  The pattern is not used until it is marked as care.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Sfm_NtkSimAddCex( Sfm_Ntk_t * p, int iPat )
+{
+    word * pSim;
+    int iVar, w = SFM_WIN_RAND + iPat / 64, b = iPat % 64;
+    assert( iPat < Sfm_NtkSimCexMax(p) );
+    for ( iVar = 1; iVar <= Vec_IntSize(p->vOrder); iVar++ )
+    {
+        pSim = Sfm_NtkSimVar( p, iVar );
+        pSim[w] = (pSim[w] & ~((word)1 << b)) | ((word)sat_solver_var_value(p->pSat, iVar) << b);
+    }
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Checks whether the divisors can implement the node.]
+
+  Description [The divisors are the fanins of the node, except fanin f,
+  and the object iDiv (if iDiv >= 0). Returns 0 if there are two care 
+  patterns with different values of the node and the same values of 
+  the divisors. In this case, resubstitution is impossible and the SAT 
+  solver is not called.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Sfm_NtkSimCheck( Sfm_Ntk_t * p, int iNode, int f, int iDiv )
+{
+    word * pSims[SFM_FANIN_MAX+1], * pSimF = Sfm_NtkSimVar( p, Sfm_ObjSatVar(p, iNode) );
+    word pMasks[1 << (SFM_FANIN_MAX+1)], pOn[1 << (SFM_FANIN_MAX+1)], pOff[1 << (SFM_FANIN_MAX+1)];
+    int i, k, w, iFanin, nSims = 0, nMasks = 1;
+    Sfm_ObjForEachFanin( p, iNode, iFanin, i )
+        if ( i != f )
+            pSims[nSims++] = Sfm_NtkSimVar( p, Sfm_ObjSatVar(p, iFanin) );
+    if ( iDiv >= 0 )
+        pSims[nSims++] = Sfm_NtkSimVar( p, Sfm_ObjSatVar(p, iDiv) );
+    assert( nSims <= SFM_FANIN_MAX );
+    memset( pOn,  0, sizeof(word) * (1 << nSims) );
+    memset( pOff, 0, sizeof(word) * (1 << nSims) );
+    for ( w = 0; w < SFM_WIN_WORDS; w++ )
+    {
+        if ( p->pSimCare[w] == 0 )
+            continue;
+        // split the care patterns by the values of the divisors
+        pMasks[0] = p->pSimCare[w];
+        for ( nMasks = 1, k = 0; k < nSims; k++, nMasks *= 2 )
+            for ( i = 0; i < nMasks; i++ )
+            {
+                pMasks[nMasks + i] = pMasks[i] & ~pSims[k][w];
+                pMasks[i] &= pSims[k][w];
+            }
+        for ( i = 0; i < nMasks; i++ )
+        {
+            pOn[i]  |= pMasks[i] &  pSimF[w];
+            pOff[i] |= pMasks[i] & ~pSimF[w];
+        }
+    }
+    for ( i = 0; i < (1 << nSims); i++ )
+        if ( pOn[i] && pOff[i] )
+            return 0;
+    return 1;
+}
+
 /**Function*************************************************************
 
   Synopsis    [Converts a window into a SAT solver.]
@@ -73,6 +254,8 @@ int Sfm_NtkWindowToSolver( Sfm_Ntk_t * p )
     Vec_IntClear( p->vDivVars );
     Vec_IntForEachEntry( p->vDivs, iNode, i )
         Vec_IntPush( p->vDivVars, Sfm_ObjSatVar(p, iNode) );
+    // simulate the window
+    Sfm_NtkWindowSimulate( p );
     // add CNF clauses for the TFI
     Vec_IntForEachEntry( p->vOrder, iNode, i )
     {
@@ -110,6 +293,8 @@ int Sfm_NtkWindowToSolver( Sfm_Ntk_t * p )
             Sfm_ObjCleanSatVar( p, Sfm_ObjSatVar(p, iNode) );
             Sfm_ObjSetSatVar( p, iNode, p->nSatVars++ );
         }
+        // simulate the TFO and compute the care patterns
+        Sfm_NtkWindowSimulateTfo( p );
         // add CNF clauses for the TFO
         Vec_IntForEachEntry( p->vTfo, iNode, i )
         {
@@ -164,6 +349,7 @@ word Sfm_ComputeInterpolant( Sfm_Ntk_t * p )
     word * pSign, uCube, uTruth = 0;
     int status, i, Div, iVar, nFinal, * pFinal, nIter = 0;
     int pLits[2], nVars = sat_solver_nvars( p->pSat );
+    int fAddCex = p->nSimCexes + 2 <= Sfm_NtkSimCexMax(p);
     sat_solver_setnvars( p->pSat, nVars + 1 );
     pLits[0] = Abc_Var2Lit( Sfm_ObjSatVar(p, p->iPivotNode), 0 ); // F = 1
     pLits[1] = Abc_Var2Lit( nVars, 0 ); // iNewLit
@@ -177,6 +363,9 @@ word Sfm_ComputeInterpolant( Sfm_Ntk_t * p )
         if ( status == l_False )
             return uTruth;
         assert( status == l_True );
+        // remember the onset pattern
+        if ( fAddCex )
+            Sfm_NtkSimAddCex( p, p->nSimCexes );
         // remember variable values
         Vec_IntClear( p->vValues );
         Vec_IntForEachEntry( p->vDivVars, iVar, i )
@@ -222,6 +411,13 @@ word Sfm_ComputeInterpolant( Sfm_Ntk_t * p )
             Abc_InfoXorBit( (unsigned *)pSign, p->nCexes );
         }
     p->nCexes++;
+    // remember the offset pattern and make both patterns care
+    if ( fAddCex )
+    {
+        Sfm_NtkSimAddCex( p, p->nSimCexes + 1 );
+        for ( i = 0; i < 2; i++, p->nSimCexes++ )
+            p->pSimCare[SFM_WIN_RAND + p->nSimCexes / 64] |= (word)1 << (p->nSimCexes % 64);
+    }
     return SFM_SAT_SAT;
 }
 
@@ -77,6 +77,8 @@ extern Vec_Int_t *   Gia_ManDetectHalfAdders( Gia_Man_t * p, int fVerbose );
 /*=== acecOrder.c ========================================================*/
 extern Vec_Int_t *   Gia_PolynReorder( Gia_Man_t * pGia, int fVerbose, int fVeryVerbose );
 extern Vec_Int_t *   Gia_PolynFindOrder( Gia_Man_t * pGia, Vec_Int_t * vFadds, Vec_Int_t * vHadds, int fVerbose, int fVeryVerbose );
+/*=== acecPo.c ========================================================*/
+extern int           Gia_PolynVerifyMiter( Gia_Man_t * pGia, int nMonoLimit, int fVerbose );
 /*=== acecPolyn.c ========================================================*/
 extern void          Gia_PolynBuild( Gia_Man_t * pGia, Vec_Int_t * vOrder, int fSigned, int fVerbose, int fVeryVerbose );
 /*=== acecRe.c ========================================================*/
@@ -232,6 +232,13 @@ static inline void Vec_IntAppendMinusAbs( Vec_Int_t * vVec1, Vec_Int_t * vVec2,
     Vec_IntForEachEntry( vVec2, Entry, i )
         Vec_IntPushOrderAbs( vVec1, fMinus ? -Entry : Entry );
 }
+static inline void Vec_IntAppendMinus2xAbs( Vec_Int_t * vVec1, Vec_Int_t * vVec2, int fMinus )
+{
+    int Entry, i;
+    Vec_IntClear( vVec1 );
+    Vec_IntForEachEntry( vVec2, Entry, i )
+        Vec_IntPushOrderAbs( vVec1, fMinus ? (Entry > 0 ? -Entry-1 : -Entry+1) : (Entry > 0 ? Entry+1 : Entry-1) );
+}
 static inline void Vec_IntCheckUniqueOrderAbs( Vec_Int_t * p )
 {
     int i;
@@ -605,7 +612,8 @@ Vec_Wec_t * Gia_PolynBuildNew2( Gia_Man_t * pGia, Vec_Int_t * vRootLits, int nEx
 
   Synopsis    [Computing for objects.]
 
-  Description []
+  Description [Quits and returns NULL if the number of monomials exceeds
+  nMonoLimit (0 = no limit).]
                
   SideEffects []
 
@@ -636,16 +644,16 @@ static inline void Gia_PolynPrepare4( Vec_Int_t * vTempC[4], Vec_Int_t * vTempM[
     Vec_IntPushUniqueOrder( vTempM[3], iFan1 );
 }
 
-Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t * vRootLits, int nExtra, Vec_Int_t * vLeaves, Vec_Int_t * vNodes, int fSigned, int fVerbose, int fVeryVerbose )
+Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t * vRootLits, int nExtra, Vec_Int_t * vLeaves, Vec_Int_t * vNodes, int nMonoLimit, int fSigned, int fVerbose, int fVeryVerbose )
 {
     abctime clk = Abc_Clock();
-    Vec_Wec_t * vPolyn;
+    Vec_Wec_t * vPolyn = NULL;
     Vec_Wec_t * vLit2Mono = Vec_WecStart( Gia_ManObjNum(pGia) ); // mapping AIG literals into monomials
     Hsh_VecMan_t * pHashC = Hsh_VecManStart( 1000 );    // hash table for constants
     Hsh_VecMan_t * pHashM = Hsh_VecManStart( 1000 );    // hash table for monomials
     Vec_Int_t * vCoefs    = Vec_IntAlloc( 1000 );       // monomial coefficients
     Vec_Int_t * vTempC[4],  * vTempM[4];                // temporary array
-    int i, k, iObj, iLit, iMono, iConst, nMonos = 0, nBuilds = 0;
+    int i, k, iObj = -1, iLit, iMono, iConst, nMonos = 0, nBuilds = 0;
     for ( i = 0; i < 4; i++ )
         vTempC[i] = Vec_IntAlloc( 10 );
     for ( i = 0; i < 4; i++ )
@@ -678,7 +686,9 @@ Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t *
                     OutLit = Vec_IntEntry(vRootLits, Entry);
                 }
             }
-            if ( OutLit == -1 )
+            if ( OutLit == 0 ) // const0 output
+                continue;
+            if ( OutLit == -1 || OutLit == 1 )
                 nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[0], vTempM[0] );   // mono without out
             else if ( !Abc_LitIsCompl(OutLit) ) // positive literal
             {
@@ -740,8 +750,22 @@ Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t *
                 Vec_Int_t * vArrayC = Hsh_VecReadEntry( pHashC, iConst );
                 Vec_Int_t * vArrayM = Hsh_VecReadEntry( pHashM, iMono );
                 Gia_PolynPrepare4( vTempC, vTempM, vArrayC, vArrayM, iObj, Gia_ObjFaninId0(pObj, iObj), Gia_ObjFaninId1(pObj, iObj) );
-                if ( Gia_ObjIsXor(pObj) )
+                if ( Gia_ObjIsXor(pObj) && Gia_ObjFaninC0(pObj) == Gia_ObjFaninC1(pObj) )  //  C * (x + y - 2xy)
                 {
+                    Vec_IntAppendMinus2xAbs( vTempC[3], vArrayC, 1 );
+                    nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[0], vTempM[1] );   //  C * x
+                    nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[2], vTempM[2] );   //  C * y
+                    nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[3], vTempM[3] );   // -2C * x * y
+                    nBuilds += 2;
+                }
+                else if ( Gia_ObjIsXor(pObj) )  //  C * (1 - x - y + 2xy)
+                {
+                    Vec_IntAppendMinus2xAbs( vTempC[2], vArrayC, 0 );
+                    nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[0], vTempM[0] );   //  C * 1
+                    nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[1], vTempM[1] );   // -C * x
+                    nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[3], vTempM[2] );   // -C * y
+                    nMonos += Gia_PolynBuildAdd( pHashC, pHashM, vCoefs, vLit2Mono, vTempC[2], vTempM[3] );   //  2C * x * y
+                    nBuilds += 3;
                 }
                 else if ( Gia_ObjFaninC0(pObj) && Gia_ObjFaninC1(pObj) )  //  C * (1 - x) * (1 - y)
                 {
@@ -770,14 +794,25 @@ Vec_Wec_t * Gia_PolynBuildNew( Gia_Man_t * pGia, Vec_Wec_t * vSign, Vec_Int_t *
                 nBuilds++;
             }
         //printf( "Obj %5d : nMonos = %6d  nUsed = %6d\n", iObj, nBuilds, nMonos );
+        if ( nMonoLimit && nMonos > nMonoLimit )
+            break;
     }
 
     // get the results
-    vPolyn = Gia_PolynGetResult( pHashC, pHashM, vCoefs );
+    if ( nMonoLimit && nMonos > nMonoLimit )
+    {
+        if ( fVerbose )
+            printf( "The number of monomials exceeded the limit (%d) at node %d.  ", nMonoLimit, iObj );
+    }
+    else
+        vPolyn = Gia_PolynGetResult( pHashC, pHashM, vCoefs );
 
-    printf( "HashC = %d. HashM = %d.  Total = %d. Left = %d.  Used = %d.  ", 
-        Hsh_VecSize(pHashC), Hsh_VecSize(pHashM), nBuilds, nMonos, Vec_WecSize(vPolyn)/2 );
-    Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    if ( !nMonoLimit || fVerbose )
+    {
+        printf( "HashC = %d. HashM = %d.  Total = %d. Left = %d.  Used = %d.  ", 
+            Hsh_VecSize(pHashC), Hsh_VecSize(pHashM), nBuilds, nMonos, vPolyn ? Vec_WecSize(vPolyn)/2 : -1 );
+        Abc_PrintTime( 1, "Time", Abc_Clock() - clk );
+    }
 
     for ( i = 0; i < 4; i++ )
         Vec_IntFree( vTempC[i] );
@@ -842,7 +877,7 @@ void Gia_PolynBuild2Test( Gia_Man_t * pGia, char * pSign, int nExtra, int fSigne
         else if ( Gia_ObjIsCo(pObj) )
             Vec_IntPush( vRootLits, Gia_ObjFaninLit0p(pGia, pObj) );
 
-    vPolyn = Gia_PolynBuildNew( pGia, vMonos, vRootLits, nExtra, vLeaves, vNodes, fSigned, fVerbose, fVeryVerbose );
+    vPolyn = Gia_PolynBuildNew( pGia, vMonos, vRootLits, nExtra, vLeaves, vNodes, 0, fSigned, fVerbose, fVeryVerbose );
     //printf( "Polynomial has %d monomials.\n", Vec_WecSize(vPolyn)/2 );
     if ( fVerbose || fVeryVerbose )
         Gia_PolynPrintStats( vPolyn );
@@ -856,6 +891,62 @@ void Gia_PolynBuild2Test( Gia_Man_t * pGia, char * pSign, int nExtra, int fSigne
     Vec_WecFreeP( &vMonos );
 }
 
+/**Function*************************************************************
+
+  Synopsis    [Proves the dual-output miter by backward rewriting.]
+
+  Description [Rewrites the word-level signature of the miter, that is,
+  the sum of 2^i * (o1_i - o2_i) over all output pairs, into a polynomial 
+  in terms of the CIs. Since this representation is unique, the outputs 
+  are equivalent if and only if the polynomial is zero. Returns 1 if the
+  miter is proved, 0 if it is disproved, and -1 if the number of 
+  monomials exceeded nMonoLimit, which happens for non-arithmetic logic.]
+               
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+int Gia_PolynVerifyMiter( Gia_Man_t * pGia, int nMonoLimit, int fVerbose )
+{
+    Gia_Man_t * pXor;
+    Vec_Wec_t * vPolyn, * vSign;
+    Vec_Int_t * vRootLits, * vLeaves, * vNodes;
+    Gia_Obj_t * pObj;
+    int i, RetValue = -1;
+    assert( Gia_ManCoNum(pGia) % 2 == 0 );
+    // recover XORs to avoid the monomials vanishing in their AND-decomposition
+    pXor      = Gia_ManDupMuxes( pGia, 0 );
+    vRootLits = Vec_IntAlloc( Gia_ManCoNum(pXor) );
+    vLeaves   = Vec_IntAlloc( Gia_ManCiNum(pXor) );
+    vNodes    = Vec_IntAlloc( Gia_ManAndNum(pXor) );
+    Gia_ManForEachObj( pXor, pObj, i )
+        if ( Gia_ObjIsCi(pObj) )
+            Vec_IntPush( vLeaves, i );
+        else if ( Gia_ObjIsAnd(pObj) )
+            Vec_IntPush( vNodes, i );
+        else if ( Gia_ObjIsCo(pObj) )
+            Vec_IntPush( vRootLits, Gia_ObjFaninLit0p(pXor, pObj) );
+    // the signature has one monomial for each output: +/-2^(i/2) * o_i
+    vSign = Vec_WecStart( Gia_ManCoNum(pXor) );
+    for ( i = 0; i < Gia_ManCoNum(pXor); i++ )
+        Vec_IntPushTwo( Vec_WecEntry(vSign, i), i, (i & 1) ? -(1 + i/2) : 1 + i/2 );
+    vPolyn = Gia_PolynBuildNew( pXor, vSign, vRootLits, 0, vLeaves, vNodes, nMonoLimit, 0, fVerbose, 0 );
+    if ( vPolyn )
+    {
+        RetValue = (int)(Vec_WecSize(vPolyn) == 0);
+        if ( fVerbose && !RetValue )
+            Gia_PolynPrintStats( vPolyn );
+        Vec_WecFree( vPolyn );
+    }
+    Vec_WecFree( vSign );
+    Vec_IntFree( vRootLits );
+    Vec_IntFree( vLeaves );
+    Vec_IntFree( vNodes );
+    Gia_ManStop( pXor );
+    return RetValue;
+}
+
 ////////////////////////////////////////////////////////////////////////
 ///                       END OF FILE                                ///
 ////////////////////////////////////////////////////////////////////////
@@ -52,6 +52,7 @@ struct Cec_ParSat_t_
 //    int              fFirstStop;    // stop on the first sat output
     int              fLearnCls;     // perform clause learning
     int              fSaveCexes;    // saves counter-examples
+    int              nProcs;        // the number of threads for SAT solving
     int              fVerbose;      // verbose stats
 };
 
@@ -111,6 +112,7 @@ struct Cec_ParFra_t_
     int              fRunCSat;      // enable another solver
     int              fUseCones;     // use cones
     int              fUseOrigIds;   // enable recording of original IDs
+    int              nProcs;        // the number of threads for SAT solving
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
     int              iOutFail;      // the failed output
@@ -126,6 +128,7 @@ struct Cec_ParCec_t_
     int              fUseSmartCnf;  // use smart CNF computation
     int              fRewriting;    // enables AIG rewriting
     int              fNaive;        // performs naive SAT-based checking
+    int              nProcs;        // the number of threads for SAT solving
     int              fSilent;       // print no messages
     int              fVeryVerbose;  // verbose stats
     int              fVerbose;      // verbose stats
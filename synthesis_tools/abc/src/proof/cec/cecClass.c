@@ -717,24 +717,7 @@ int Cec_ManSimSimulateRound( Cec_ManSim_t * p, Vec_Ptr_t * vInfoCis, Vec_Ptr_t *
 
 //        Abc_Print( 1, "%d,%d  ", Gia_ObjValue( Gia_ObjFanin0(pObj) ), Gia_ObjValue( Gia_ObjFanin1(pObj) ) );
 
-        if ( Gia_ObjFaninC0(pObj) )
-        {
-            if ( Gia_ObjFaninC1(pObj) )
-                for ( w = 1; w <= p->nWords; w++ )
-                    pRes[w] = ~(pRes0[w] | pRes1[w]);
-            else
-                for ( w = 1; w <= p->nWords; w++ )
-                    pRes[w] = ~pRes0[w] & pRes1[w];
-        }
-        else
-        {
-            if ( Gia_ObjFaninC1(pObj) )
-                for ( w = 1; w <= p->nWords; w++ )
-                    pRes[w] = pRes0[w] & ~pRes1[w];
-            else
-                for ( w = 1; w <= p->nWords; w++ )
-                    pRes[w] = pRes0[w] & pRes1[w];
-        }
+        Gia_ManSimAndWords( pRes + 1, pRes0 + 1, pRes1 + 1, Gia_ObjFaninC0(pObj), Gia_ObjFaninC1(pObj), p->nWords );
 
 references:
         // if this node is candidate constant, collect it
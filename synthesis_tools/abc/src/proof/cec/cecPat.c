@@ -145,7 +145,9 @@ int Cec_ManPatComputePattern_rec( Cec_ManSat_t * pSat, Gia_Man_t * p, Gia_Obj_t
     Gia_ObjSetTravIdCurrent(p, pObj);
     if ( Gia_ObjIsCi(pObj) )
     {
-        pObj->fMark1 = Cec_ObjSatVarValue( pSat, pObj );
+        // without the solver, the CI values are assigned by the caller
+        if ( pSat )
+            pObj->fMark1 = Cec_ObjSatVarValue( pSat, pObj );
         return 1;
     }
     assert( Gia_ObjIsAnd(pObj) );
@@ -356,7 +358,7 @@ void Cec_ManPatCleanMark0( Gia_Man_t * p, Gia_Obj_t * pObj )
   SeeAlso     []
 
 ***********************************************************************/
-void Cec_ManPatSavePattern( Cec_ManPat_t * pMan, Cec_ManSat_t *  p, Gia_Obj_t * pObj )
+static void Cec_ManPatSavePatternInt( Cec_ManPat_t * pMan, Cec_ManSat_t * p, Gia_Man_t * pAig, Gia_Obj_t * pObj )
 {
     Vec_Int_t * vPat;
     int nPatLits;
@@ -367,8 +369,8 @@ void Cec_ManPatSavePattern( Cec_ManPat_t * pMan, Cec_ManSat_t *  p, Gia_Obj_t *
     pMan->nPatsAll++;
     // compute values in the cone of influence
 //clk = Abc_Clock();
-    Gia_ManIncrementTravId( p->pAig );
-    nPatLits = Cec_ManPatComputePattern_rec( p, p->pAig, Gia_ObjFanin0(pObj) );
+    Gia_ManIncrementTravId( pAig );
+    nPatLits = Cec_ManPatComputePattern_rec( p, pAig, Gia_ObjFanin0(pObj) );
     assert( (Gia_ObjFanin0(pObj)->fMark1 ^ Gia_ObjFaninC0(pObj)) == 1 );
     pMan->nPatLits += nPatLits;
     pMan->nPatLitsAll += nPatLits;
@@ -376,12 +378,12 @@ void Cec_ManPatSavePattern( Cec_ManPat_t * pMan, Cec_ManSat_t *  p, Gia_Obj_t *
     // compute sensitizing path
 //clk = Abc_Clock();
     Vec_IntClear( pMan->vPattern1 );
-    Gia_ManIncrementTravId( p->pAig );
-    Cec_ManPatComputePattern1_rec( p->pAig, Gia_ObjFanin0(pObj), pMan->vPattern1 );
+    Gia_ManIncrementTravId( pAig );
+    Cec_ManPatComputePattern1_rec( pAig, Gia_ObjFanin0(pObj), pMan->vPattern1 );
     // compute sensitizing path
     Vec_IntClear( pMan->vPattern2 );
-    Gia_ManIncrementTravId( p->pAig );
-    Cec_ManPatComputePattern2_rec( p->pAig, Gia_ObjFanin0(pObj), pMan->vPattern2 );
+    Gia_ManIncrementTravId( pAig );
+    Cec_ManPatComputePattern2_rec( pAig, Gia_ObjFanin0(pObj), pMan->vPattern2 );
     // compare patterns
     vPat = Vec_IntSize(pMan->vPattern1) < Vec_IntSize(pMan->vPattern2) ? pMan->vPattern1 : pMan->vPattern2;
     pMan->nPatLitsMin += Vec_IntSize(vPat);
@@ -389,7 +391,7 @@ void Cec_ManPatSavePattern( Cec_ManPat_t * pMan, Cec_ManSat_t *  p, Gia_Obj_t *
 //pMan->timeShrink += Abc_Clock() - clk;
     // verify pattern using ternary simulation
 //clk = Abc_Clock();
-//    Cec_ManPatVerifyPattern( p->pAig, pObj, vPat );
+//    Cec_ManPatVerifyPattern( pAig, pObj, vPat );
 //pMan->timeVerify += Abc_Clock() - clk;
     // sort pattern
 //clk = Abc_Clock();
@@ -399,6 +401,18 @@ void Cec_ManPatSavePattern( Cec_ManPat_t * pMan, Cec_ManSat_t *  p, Gia_Obj_t *
     Cec_ManPatStore( pMan, vPat );
     pMan->timeTotal += Abc_Clock() - clkTotal;
 }
+void Cec_ManPatSavePattern( Cec_ManPat_t * pMan, Cec_ManSat_t *  p, Gia_Obj_t * pObj )
+{
+    Cec_ManPatSavePatternInt( pMan, p, p->pAig, pObj );
+}
+void Cec_ManPatSavePatternModel( Cec_ManPat_t * pMan, Gia_Man_t * pAig, Gia_Obj_t * pObj, Vec_Int_t * vModel )
+{
+    int i, iLit;
+    // assign the CI values (positive literal stands for value 1)
+    Vec_IntForEachEntry( vModel, iLit, i )
+        Gia_ManCi( pAig, Abc_Lit2Var(iLit) )->fMark1 = !Abc_LitIsCompl(iLit);
+    Cec_ManPatSavePatternInt( pMan, NULL, pAig, pObj );
+}
 void Cec_ManPatSavePatternCSat( Cec_ManPat_t * pMan, Vec_Int_t * vPat )
 {
     // sort pattern
@@ -695,6 +695,11 @@ void Cec_ManSatSolve( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPar
     Gia_Obj_t * pObj;
     int i, status;
     abctime clk = Abc_Clock(), clk2;
+    if ( pPars->nProcs > 1 )
+    {
+        Cec_ManSatSolvePar( pPat, pAig, pPars, vIdsOrig, vMiterPairs, vEquivPairs );
+        return;
+    }
     Vec_PtrFreeP( &pAig->vSeqModelVec );
     if ( pPars->fSaveCexes )
         pAig->vSeqModelVec = Vec_PtrStart( Gia_ManCoNum(pAig) );
@@ -0,0 +1,319 @@
+/**CFile****************************************************************
+
+  FileName    [cecSolvePar.c]
+
+  SystemName  [ABC: Logic synthesis and verification system.]
+
+  PackageName [Combinational equivalence checking.]
+
+  Synopsis    [Performs one round of SAT solving using several threads.]
+
+  Author      [agent]
+
+  Affiliation []
+
+  Date        [Ver. 1.0. Started - October 18, 2026.]
+
+  Revision    [$Id: cecSolvePar.c,v 1.00 2026/10/18 00:00:00 agent Exp $]
+
+***********************************************************************/
+
+#include "cecInt.h"
+
+#ifdef ABC_USE_PTHREADS
+
+#ifdef _WIN32
+#include "../lib/pthread.h"
+#else
+#include <pthread.h>
+#include <unistd.h>
+#endif
+
+#endif
+
+ABC_NAMESPACE_IMPL_START
+
+
+////////////////////////////////////////////////////////////////////////
+///                        DECLARATIONS                              ///
+////////////////////////////////////////////////////////////////////////
+
+#define CEC_PAR_THR_MAX   100   // the max number of threads
+#define CEC_PAR_CHUNK      16   // the number of outputs taken by a thread at a time
+
+typedef struct Cec_ParShare_t_ Cec_ParShare_t;
+struct Cec_ParShare_t_
+{
+    Gia_Man_t *      pAig;           // the AIG whose outputs are solved (read-only)
+    Cec_ParSat_t *   pPars;          // SAT solving parameters
+    char *           pStatus;        // the status of each output (0=SAT, 1=UNSAT, -1=UNDEC)
+    Vec_Int_t **     pModels;        // the CI assignments of the disproved outputs
+    int              iNext;          // the next output to be solved
+    volatile int     fStop;          // stop solving (the miter is disproved)
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_t  Mutex;          // protects iNext
+#endif
+};
+
+typedef struct Cec_ParThData_t_ Cec_ParThData_t;
+struct Cec_ParThData_t_
+{
+    Cec_ParShare_t * pShare;         // the shared data
+    Cec_ManSat_t *   pSat;           // the solver owned by this thread
+};
+
+static inline int Cec_ObjSatNum( Cec_ManSat_t * p, Gia_Obj_t * pObj ) { return p->pSatVars[Gia_ObjId(p->pAig,pObj)]; }
+
+////////////////////////////////////////////////////////////////////////
+///                     FUNCTION DEFINITIONS                         ///
+////////////////////////////////////////////////////////////////////////
+
+/**Function*************************************************************
+
+  Synopsis    [Records the values of the CIs in the current model.]
+
+  Description [Only the CIs that have SAT variables are recorded; they
+  include all CIs in the cone of the disproved output. The value of a CI
+  is stored as a literal, which is positive if the value is 1.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Vec_Int_t * Cec_ManSatParDeriveModel( Cec_ManSat_t * p )
+{
+    Vec_Int_t * vModel = Vec_IntAlloc( 100 );
+    Gia_Obj_t * pObj;
+    int i;
+    Vec_PtrForEachEntry( Gia_Obj_t *, p->vUsedNodes, pObj, i )
+        if ( Gia_ObjIsCi(pObj) )
+            Vec_IntPush( vModel, Abc_Var2Lit(Gia_ObjCioId(pObj), !sat_solver_var_value(p->pSat, Cec_ObjSatNum(p, pObj))) );
+    return vModel;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Derives the counter-example from the model.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static Abc_Cex_t * Cec_ManSatParDeriveCex( Gia_Man_t * pAig, Vec_Int_t * vModel, int iOut )
+{
+    Abc_Cex_t * pCex;
+    int i, iLit;
+    pCex = Abc_CexAlloc( 0, Gia_ManCiNum(pAig), 1 );
+    pCex->iPo = iOut;
+    pCex->iFrame = 0;
+    Vec_IntForEachEntry( vModel, iLit, i )
+        if ( !Abc_LitIsCompl(iLit) )
+            Abc_InfoSetBit( pCex->pData, Abc_Lit2Var(iLit) );
+    return pCex;
+}
+
+/**Function*************************************************************
+
+  Synopsis    [Solves the outputs taken from the shared counter.]
+
+  Description [The AIG is only read by the threads: each thread has its
+  own solver and its own mapping of the AIG nodes into SAT variables.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void Cec_ManSatParSolveRange( Cec_ParThData_t * pThData )
+{
+    Cec_ParShare_t * pShare = pThData->pShare;
+    Gia_Man_t * pAig = pShare->pAig;
+    Gia_Obj_t * pObj;
+    int i, iStart, status;
+    while ( !pShare->fStop )
+    {
+#ifdef ABC_USE_PTHREADS
+        pthread_mutex_lock( &pShare->Mutex );
+#endif
+        iStart = pShare->iNext;
+        pShare->iNext += CEC_PAR_CHUNK;
+#ifdef ABC_USE_PTHREADS
+        pthread_mutex_unlock( &pShare->Mutex );
+#endif
+        if ( iStart >= Gia_ManCoNum(pAig) )
+            break;
+        for ( i = iStart; i < Abc_MinInt(iStart + CEC_PAR_CHUNK, Gia_ManCoNum(pAig)) && !pShare->fStop; i++ )
+        {
+            pObj = Gia_ManCo( pAig, i );
+            if ( Gia_ObjIsConst0(Gia_ObjFanin0(pObj)) )
+            {
+                pShare->pStatus[i] = 1;
+                continue;
+            }
+            status = Cec_ManSatCheckNode( pThData->pSat, Gia_ObjChild0(pObj) );
+            pShare->pStatus[i] = (char)status;
+            if ( status != 0 )
+                continue;
+            pShare->pModels[i] = Cec_ManSatParDeriveModel( pThData->pSat );
+            if ( pShare->pPars->fCheckMiter )
+                pShare->fStop = 1;
+        }
+    }
+}
+
+#ifdef ABC_USE_PTHREADS
+
+/**Function*************************************************************
+
+  Synopsis    [Thread procedure.]
+
+  Description []
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+static void * Cec_ManSatParWorkerThread( void * pArg )
+{
+    Cec_ManSatParSolveRange( (Cec_ParThData_t *)pArg );
+    pthread_exit( NULL );
+    return NULL;
+}
+
+#endif
+
+/**Function*************************************************************
+
+  Synopsis    [Performs one round of solving for the POs of the AIG.]
+
+  Description [Same as Cec_ManSatSolve() but the outputs are divided
+  among pPars->nProcs threads, each having its own SAT solver built
+  incrementally for the cones of its outputs. When all threads are
+  done, the results are merged in the order of the outputs: the proved
+  outputs are labeled (pObj->fMark1), the equivalent pairs are recorded,
+  and the satisfying assignments are saved into the pattern manager, to
+  be used to refine the equivalence classes.]
+
+  SideEffects []
+
+  SeeAlso     []
+
+***********************************************************************/
+void Cec_ManSatSolvePar( Cec_ManPat_t * pPat, Gia_Man_t * pAig, Cec_ParSat_t * pPars, Vec_Int_t * vIdsOrig, Vec_Int_t * vMiterPairs, Vec_Int_t * vEquivPairs )
+{
+    Cec_ParThData_t ThData[CEC_PAR_THR_MAX];
+#ifdef ABC_USE_PTHREADS
+    pthread_t WorkerThread[CEC_PAR_THR_MAX];
+#endif
+    Cec_ParShare_t Share, * pShare = &Share;
+    Gia_Obj_t * pObj;
+    int i, status, nProcs = Abc_MinInt( pPars->nProcs, CEC_PAR_THR_MAX );
+    abctime clk = Abc_Clock();
+    Vec_PtrFreeP( &pAig->vSeqModelVec );
+    if ( pPars->fSaveCexes )
+        pAig->vSeqModelVec = Vec_PtrStart( Gia_ManCoNum(pAig) );
+    // reset the manager
+    if ( pPat )
+    {
+        pPat->iStart = Vec_StrSize(pPat->vStorage);
+        pPat->nPats = 0;
+        pPat->nPatLits = 0;
+        pPat->nPatLitsMin = 0;
+    }
+    // precompute the data read by the threads
+    Gia_ManSetPhase( pAig );
+    Gia_ManLevelNum( pAig );
+    // start the shared data
+    memset( pShare, 0, sizeof(Cec_ParShare_t) );
+    pShare->pAig    = pAig;
+    pShare->pPars   = pPars;
+    pShare->pStatus = ABC_FALLOC( char, Gia_ManCoNum(pAig) );
+    pShare->pModels = ABC_CALLOC( Vec_Int_t *, Gia_ManCoNum(pAig) );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        ThData[i].pShare = pShare;
+        ThData[i].pSat   = Cec_ManSatCreate( pAig, pPars );
+    }
+#ifdef ABC_USE_PTHREADS
+    pthread_mutex_init( &pShare->Mutex, NULL );
+    for ( i = 0; i < nProcs; i++ )
+    {
+        status = pthread_create( WorkerThread + i, NULL, Cec_ManSatParWorkerThread, (void *)(ThData + i) );
+        assert( status == 0 );
+    }
+    for ( i = 0; i < nProcs; i++ )
+        pthread_join( WorkerThread[i], NULL );
+    pthread_mutex_destroy( &pShare->Mutex );
+#else
+    for ( i = 0; i < nProcs; i++ )
+        Cec_ManSatParSolveRange( ThData + i );
+#endif
+    // merge the results
+    Gia_ManForEachCo( pAig, pObj, i )
+    {
+        status = pShare->pStatus[i];
+        pObj->fMark0 = (status == 0);
+        pObj->fMark1 = (status == 1);
+        if ( status == 1 && vIdsOrig && !Gia_ObjIsConst0(Gia_ObjFanin0(pObj)) )
+        {
+            int iObj1 = Vec_IntEntry(vMiterPairs, 2*i);
+            int iObj2 = Vec_IntEntry(vMiterPairs, 2*i+1);
+            int OrigId1 = Vec_IntEntry(vIdsOrig, iObj1);
+            int OrigId2 = Vec_IntEntry(vIdsOrig, iObj2);
+            assert( OrigId1 >= 0 && OrigId2 >= 0 );
+            Vec_IntPushTwo( vEquivPairs, OrigId1, OrigId2 );
+        }
+        if ( pPars->fSaveCexes && status == 1 )
+            Vec_PtrWriteEntry( pAig->vSeqModelVec, i, (Abc_Cex_t *)(ABC_PTRINT_T)1 );
+        if ( status != 0 )
+            continue;
+        if ( pPars->fSaveCexes )
+            Vec_PtrWriteEntry( pAig->vSeqModelVec, i, Cec_ManSatParDeriveCex(pAig, pShare->pModels[i], i) );
+        // save the pattern
+        if ( pPat )
+        {
+            abctime clk3 = Abc_Clock();
+            Cec_ManPatSavePatternModel( pPat, pAig, pObj, pShare->pModels[i] );
+            pPat->timeTotalSave += Abc_Clock() - clk3;
+        }
+    }
+    // collect statistics in the first manager
+    for ( i = 1; i < nProcs; i++ )
+    {
+        ThData[0].pSat->nSatUnsat    += ThData[i].pSat->nSatUnsat;
+        ThData[0].pSat->nSatSat      += ThData[i].pSat->nSatSat;
+        ThData[0].pSat->nSatUndec    += ThData[i].pSat->nSatUndec;
+        ThData[0].pSat->nSatTotal    += ThData[i].pSat->nSatTotal;
+        ThData[0].pSat->nConfUnsat   += ThData[i].pSat->nConfUnsat;
+        ThData[0].pSat->nConfSat     += ThData[i].pSat->nConfSat;
+        ThData[0].pSat->nConfUndec   += ThData[i].pSat->nConfUndec;
+        ThData[0].pSat->timeSatUnsat += ThData[i].pSat->timeSatUnsat;
+        ThData[0].pSat->timeSatSat   += ThData[i].pSat->timeSatSat;
+        ThData[0].pSat->timeSatUndec += ThData[i].pSat->timeSatUndec;
+    }
+    ThData[0].pSat->timeTotal = Abc_Clock() - clk;
+    if ( pPars->fVerbose )
+    {
+        Abc_Print( 1, "Solved %d outputs using %d threads.\n", Gia_ManCoNum(pAig), nProcs );
+        Cec_ManSatPrintStats( ThData[0].pSat );
+    }
+    for ( i = 0; i < nProcs; i++ )
+        Cec_ManSatStop( ThData[i].pSat );
+    for ( i = 0; i < Gia_ManCoNum(pAig); i++ )
+        Vec_IntFreeP( &pShare->pModels[i] );
+    ABC_FREE( pShare->pModels );
+    ABC_FREE( pShare->pStatus );
+}
+
+
+////////////////////////////////////////////////////////////////////////
+///                       END OF FILE                                ///
+////////////////////////////////////////////////////////////////////////
+
+
+ABC_NAMESPACE_IMPL_END
@@ -65,6 +65,11 @@ struct satoko_opts {
     unsigned clause_max_sz_bin_resol;
     unsigned clause_min_lbd_bin_resol;
     float garbage_max_ratio;
+
+    /* Inprocessing */
+    unsigned n_conf_inprocess;         /* N.of conflicts between inprocessing rounds (0 = disabled) */
+    unsigned clause_max_sz_subsume;    /* Max clause size used for subsumption (0 = disabled) */
+    unsigned clause_max_lbd_vivify;    /* Max LBD of a learnt clause to be vivified (0 = disabled) */
     char verbose;
     char no_simplify;
 };
@@ -83,6 +88,12 @@ struct satoko_stats {
 
     long n_original_lits;
     long n_learnt_lits;
+
+    unsigned n_inprocess;
+    long n_subsumed;
+    long n_strengthened;
+    long n_vivified;
+    long n_vivified_lits;
 };
 
 
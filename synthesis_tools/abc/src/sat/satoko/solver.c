@@ -477,6 +477,296 @@ static inline void solver_reduce_cdb(solver_t *s)
         solver_garbage_collect(s);
 }
 
+//===------------------------------------------------------------------------===
+// Inprocessing
+//===------------------------------------------------------------------------===
+/* Removes an unwatched clause from the database. The clause is only marked
+ * here, the caller is responsible for dropping it from 'originals' or
+ * 'learnts'. */
+static inline void clause_delete(solver_t *s, struct clause *clause)
+{
+    if (clause->f_learnt)
+        s->stats.n_learnt_lits -= clause->size;
+    else
+        s->stats.n_original_lits -= clause->size;
+    clause->f_mark = 1;
+    cdb_remove(s->all_clauses, clause);
+}
+
+/* Replaces the literals of an unwatched clause by 'lits', which must be a
+ * subset of its current literals, and watches it again. Must be called at
+ * decision level 0. Unit clauses are enqueued and propagated. Returns
+ * SATOKO_ERR if the problem was found to be UNSAT. */
+static inline int clause_shrink(solver_t *s, unsigned cref, unsigned *lits, unsigned size)
+{
+    struct clause *clause = clause_fetch(s, cref);
+    unsigned n_removed = clause->size - size;
+    clause_act_t act;
+
+    assert(solver_dlevel(s) == 0);
+    assert(size < clause->size);
+    if (size == 0)
+        return SATOKO_ERR;
+    if (size == 1) {
+        unsigned lit = lits[0];
+        clause_delete(s, clause);
+        if (lit_value(s, lit) == SATOKO_LIT_FALSE)
+            return SATOKO_ERR;
+        if (var_value(s, lit2var(lit)) == SATOKO_VAR_UNASSING) {
+            solver_enqueue(s, lit, UNDEF);
+            if (solver_propagate(s) != UNDEF)
+                return SATOKO_ERR;
+        }
+        return SATOKO_OK;
+    }
+    if (clause->f_learnt) {
+        act = clause->data[clause->size].act;
+        memmove(&(clause->data[0].lit), lits, sizeof(unsigned) * size);
+        clause->data[size].act = act;
+        if (clause->lbd > size)
+            clause->lbd = size;
+        s->stats.n_learnt_lits -= n_removed;
+    } else {
+        memmove(&(clause->data[0].lit), lits, sizeof(unsigned) * size);
+        s->stats.n_original_lits -= n_removed;
+    }
+    clause->size = size;
+    s->all_clauses->wasted += n_removed;
+    clause_watch(s, cref);
+    return SATOKO_OK;
+}
+
+static inline void solver_compact_clauses(solver_t *s, vec_uint_t *crefs)
+{
+    unsigned i, j, cref;
+
+    j = 0;
+    vec_uint_foreach(crefs, cref, i)
+        if (!clause_fetch(s, cref)->f_mark)
+            vec_uint_assign(crefs, j++, cref);
+    vec_uint_shrink(crefs, j);
+}
+
+/* Checks the original clause 'cref' against 'clause', whose literals are set
+ * in 'marks', and removes it or its negated literal if possible. */
+static inline int solver_subsume_one(solver_t *s, struct clause *clause, unsigned cref, char *marks, long *n_steps)
+{
+    struct clause *other = clause_fetch(s, cref);
+    unsigned *lits = &(other->data[0].lit);
+    unsigned k, n_found = 0, flip = UNDEF;
+
+    if (other == clause || other->f_mark || other->size < clause->size)
+        return SATOKO_OK;
+    *n_steps += other->size;
+    for (k = 0; k < other->size; k++) {
+        if (marks[lits[k]])
+            n_found++;
+        else if (marks[lit_compl(lits[k])]) {
+            if (flip != UNDEF)
+                return SATOKO_OK;
+            flip = k;
+            n_found++;
+        }
+    }
+    if (n_found < clause->size)
+        return SATOKO_OK;
+    clause_unwatch(s, cref);
+    if (flip == UNDEF) {
+        s->stats.n_subsumed++;
+        clause_delete(s, other);
+        return SATOKO_OK;
+    }
+    s->stats.n_strengthened++;
+    vec_uint_clear(s->temp_lits);
+    for (k = 0; k < other->size; k++)
+        if (k != flip)
+            vec_uint_push_back(s->temp_lits, lits[k]);
+    return clause_shrink(s, cref, vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits));
+}
+
+/**
+ *  Backward subsumption and self-subsuming resolution over the original
+ *  clauses. Every clause C with at most 'clause_max_sz_subsume' literals is
+ *  checked against the clauses in the occurrence lists of its least frequent
+ *  variable: a clause D containing C is deleted, and a clause D containing C
+ *  with exactly one literal negated loses that literal.
+ *
+ *  Only clauses implied by the remaining ones are removed or weakened, so the
+ *  result stays valid when the user adds more clauses later.
+ */
+static int solver_subsume(solver_t *s)
+{
+    unsigned n_lits = 2 * vec_char_size(s->assigns);
+    unsigned *occ_start = satoko_calloc(unsigned, n_lits + 1);
+    unsigned *occ = NULL;
+    char *marks = satoko_calloc(char, n_lits);
+    unsigned i, j, k, sz, cref;
+    long n_steps = 0, n_steps_max = 10 * s->stats.n_original_lits + 100000;
+    int status = SATOKO_OK;
+
+    /* Build occurrence lists of clauses without assigned literals */
+    vec_uint_foreach(s->originals, cref, i) {
+        struct clause *clause = clause_fetch(s, cref);
+        for (k = 0; k < clause->size; k++)
+            if (var_value(s, lit2var(clause->data[k].lit)) != SATOKO_VAR_UNASSING)
+                break;
+        clause->f_deletable = (k == clause->size);
+        if (clause->f_deletable)
+            for (k = 0; k < clause->size; k++)
+                occ_start[clause->data[k].lit + 1]++;
+    }
+    for (i = 0; i < n_lits; i++)
+        occ_start[i + 1] += occ_start[i];
+    occ = satoko_alloc(unsigned, occ_start[n_lits] + 1);
+    vec_uint_foreach(s->originals, cref, i) {
+        struct clause *clause = clause_fetch(s, cref);
+        if (clause->f_deletable)
+            for (k = 0; k < clause->size; k++)
+                occ[occ_start[clause->data[k].lit]++] = cref;
+    }
+    for (i = n_lits; i > 0; i--)
+        occ_start[i] = occ_start[i - 1];
+    occ_start[0] = 0;
+
+    /* Try shorter clauses first, they are the most likely to subsume */
+    for (sz = 2; sz <= s->opts.clause_max_sz_subsume && status == SATOKO_OK; sz++) {
+        vec_uint_foreach(s->originals, cref, i) {
+            struct clause *clause = clause_fetch(s, cref);
+            unsigned *lits = &(clause->data[0].lit);
+            unsigned pivot = lits[0], pivot_cost = UNDEF;
+
+            if (clause->size != sz || clause->f_mark || !clause->f_deletable)
+                continue;
+            if (n_steps > n_steps_max)
+                break;
+            for (k = 0; k < sz; k++) {
+                unsigned cost = occ_start[lits[k] + 1] - occ_start[lits[k]] +
+                                occ_start[lit_compl(lits[k]) + 1] - occ_start[lit_compl(lits[k])];
+                marks[lits[k]] = 1;
+                if (cost < pivot_cost) {
+                    pivot_cost = cost;
+                    pivot = lits[k];
+                }
+            }
+            for (j = occ_start[pivot]; j < occ_start[pivot + 1] && status == SATOKO_OK; j++)
+                status = solver_subsume_one(s, clause, occ[j], marks, &n_steps);
+            pivot = lit_compl(pivot);
+            for (j = occ_start[pivot]; j < occ_start[pivot + 1] && status == SATOKO_OK; j++)
+                status = solver_subsume_one(s, clause, occ[j], marks, &n_steps);
+            for (k = 0; k < clause->size; k++)
+                marks[clause->data[k].lit] = 0;
+            if (status != SATOKO_OK)
+                break;
+        }
+    }
+    vec_uint_foreach(s->originals, cref, i)
+        clause_fetch(s, cref)->f_deletable = 0;
+    solver_compact_clauses(s, s->originals);
+    satoko_free(occ_start);
+    satoko_free(occ);
+    satoko_free(marks);
+    return status;
+}
+
+/**
+ *  Vivification of learnt clauses. The literals of a clause are assigned to
+ *  false one by one and propagated without the clause itself. A literal that
+ *  becomes false is redundant, while a conflict or a literal that becomes true
+ *  makes the remaining literals redundant. Saved phases are left untouched.
+ */
+static int solver_vivify(solver_t *s)
+{
+    vec_char_t *polarity = vec_char_alloc(vec_char_size(s->polarity));
+    long n_props_max = s->stats.n_propagations_all + 10000 +
+                       (s->stats.n_propagations_all - s->n_props_inprocess) / 10;
+    unsigned i, k, cref;
+    int status = SATOKO_OK;
+
+    vec_char_copy(polarity, s->polarity);
+    vec_uint_foreach(s->learnts, cref, i) {
+        struct clause *clause = clause_fetch(s, cref);
+        unsigned *lits = &(clause->data[0].lit);
+        int f_satisfied = 0;
+
+        if (s->stats.n_propagations_all > n_props_max)
+            break;
+        if (clause->f_mark || clause->size <= 2 || clause->lbd > s->opts.clause_max_lbd_vivify)
+            continue;
+        if (lit_reason(s, lits[0]) == cref)
+            continue;
+        clause_unwatch(s, cref);
+        vec_uint_clear(s->temp_lits);
+        for (k = 0; k < clause->size; k++) {
+            unsigned lit = lits[k];
+            if (lit_value(s, lit) == SATOKO_LIT_TRUE) {
+                if (lit_dlevel(s, lit) == 0)
+                    f_satisfied = 1;
+                else
+                    vec_uint_push_back(s->temp_lits, lit);
+                break;
+            }
+            if (lit_value(s, lit) == SATOKO_LIT_FALSE)
+                continue;
+            vec_uint_push_back(s->temp_lits, lit);
+            vec_uint_push_back(s->trail_lim, vec_uint_size(s->trail));
+            solver_enqueue(s, lit_compl(lit), UNDEF);
+            if (solver_propagate(s) != UNDEF)
+                break;
+        }
+        solver_cancel_until(s, 0);
+        if (f_satisfied) {
+            clause_delete(s, clause);
+            continue;
+        }
+        if (vec_uint_size(s->temp_lits) == clause->size) {
+            clause_watch(s, cref);
+            continue;
+        }
+        s->stats.n_vivified++;
+        s->stats.n_vivified_lits += clause->size - vec_uint_size(s->temp_lits);
+        status = clause_shrink(s, cref, vec_uint_data(s->temp_lits), vec_uint_size(s->temp_lits));
+        if (status != SATOKO_OK)
+            break;
+    }
+    vec_char_copy(s->polarity, polarity);
+    vec_char_free(polarity);
+    solver_compact_clauses(s, s->learnts);
+    return status;
+}
+
+/* Runs one round of inprocessing at decision level 0 and compacts the clause
+ * arena if enough of it became garbage. Returns SATOKO_ERR if the problem was
+ * found to be UNSAT. */
+static int solver_inprocess(solver_t *s)
+{
+    int status = SATOKO_OK;
+
+    assert(solver_dlevel(s) == 0);
+    s->stats.n_inprocess++;
+    /* Subsumption only makes sense if the original clauses changed */
+    if (s->opts.clause_max_sz_subsume &&
+        (s->n_originals_subsume != vec_uint_size(s->originals) ||
+         s->n_trail_subsume != vec_uint_size(s->trail))) {
+        status = solver_subsume(s);
+        s->n_originals_subsume = vec_uint_size(s->originals);
+        s->n_trail_subsume = vec_uint_size(s->trail);
+    }
+    if (status == SATOKO_OK && s->opts.clause_max_lbd_vivify)
+        status = solver_vivify(s);
+    s->n_confl_bfr_inprocess = s->stats.n_conflicts_all + s->opts.n_conf_inprocess;
+    s->n_props_inprocess = s->stats.n_propagations_all;
+
+    if (s->opts.verbose) {
+        printf("inprocess: Subsumed %7ld  Strengthened %7ld  Vivified %7ld (lits %7ld)\n",
+               s->stats.n_subsumed, s->stats.n_strengthened,
+               s->stats.n_vivified, s->stats.n_vivified_lits);
+        fflush(stdout);
+    }
+    if (status == SATOKO_OK && cdb_wasted(s->all_clauses) > cdb_size(s->all_clauses) * s->opts.garbage_max_ratio)
+        solver_garbage_collect(s);
+    return status;
+}
+
 //===------------------------------------------------------------------------===
 // Solver external functions
 //===------------------------------------------------------------------------===
@@ -653,6 +943,12 @@ char solver_search(solver_t *s)
             if (!s->opts.no_simplify && solver_dlevel(s) == 0)
                 satoko_simplify(s);
 
+            /* Inprocessing */
+            if (s->opts.n_conf_inprocess && !s->opts.no_simplify && !s->book_vars &&
+                solver_dlevel(s) == 0 && s->stats.n_conflicts_all >= s->n_confl_bfr_inprocess &&
+                solver_inprocess(s) == SATOKO_ERR)
+                return SATOKO_UNSAT;
+
             /* Reduce the set of learnt clauses */
             if (s->opts.learnt_ratio && vec_uint_size(s->learnts) > 100 &&
                 s->stats.n_conflicts >= s->n_confl_bfr_reduce) {
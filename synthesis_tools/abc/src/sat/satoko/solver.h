@@ -84,6 +84,12 @@ struct solver_t_ {
     long n_confl_bfr_reduce;
     float sum_lbd;
 
+    /* Temporary data used by inprocessing */
+    long n_confl_bfr_inprocess; /* N.of conflicts (all) before next round */
+    long n_props_inprocess;     /* N.of propagations (all) at the last round */
+    unsigned n_originals_subsume; /* N.of original clauses after last subsumption */
+    unsigned n_trail_subsume;     /* Trail size after last subsumption */
+
     /* Misc temporary */
     unsigned cur_stamp; /* Used for marking literals and levels of interest */
     vec_uint_t *stamps; /* Multipurpose stamp used to calculate LBD and
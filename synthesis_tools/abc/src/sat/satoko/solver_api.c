@@ -80,6 +80,12 @@ static inline void print_stats(solver_t *s)
     printf("conflicts     : %10ld\n", s->stats.n_conflicts);
     printf("decisions     : %10ld\n", s->stats.n_decisions);
     printf("propagations  : %10ld\n", s->stats.n_propagations);
+    if (s->stats.n_inprocess) {
+        printf("inprocessing  : %10d\n", s->stats.n_inprocess);
+        printf("  subsumed    : %10ld\n", s->stats.n_subsumed);
+        printf("  strengthened: %10ld\n", s->stats.n_strengthened);
+        printf("  vivified    : %10ld (%ld lits)\n", s->stats.n_vivified, s->stats.n_vivified_lits);
+    }
 }
 
 //===------------------------------------------------------------------------===
@@ -188,6 +194,10 @@ void satoko_default_opts(satoko_opts_t *opts)
     opts->clause_min_lbd_bin_resol = 6;
 
     opts->garbage_max_ratio = (float) 0.3;
+    /* Inprocessing */
+    opts->n_conf_inprocess = 0;
+    opts->clause_max_sz_subsume = 16;
+    opts->clause_max_lbd_vivify = 6;
 }
 
 /**
@@ -217,6 +227,7 @@ int satoko_simplify(solver_t * s)
             clause->f_mark = 1;
             s->stats.n_original_lits -= clause->size;
             clause_unwatch(s, cref);
+            cdb_remove(s->all_clauses, clause);
         } else
             vec_uint_assign(s->originals, j++, cref);
     }
@@ -497,6 +508,10 @@ void satoko_reset(satoko_t *s)
     s->n_confl_bfr_reduce = s->opts.n_conf_fst_reduce;
     s->RC1 = 1;
     s->RC2 = s->opts.n_conf_fst_reduce;
+    s->n_confl_bfr_inprocess = 0;
+    s->n_props_inprocess = 0;
+    s->n_originals_subsume = 0;
+    s->n_trail_subsume = 0;
     s->book_cl_orig = 0;
     s->book_cl_lrnt = 0;
     s->book_cdb = 0;
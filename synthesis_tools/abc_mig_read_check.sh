@@ -0,0 +1 @@
+abc/abc -c "&if2 -K 6 mockturtle/test/benchmarks/addr16.mig; &put; cec mockturtle/test/benchmarks/addr16.aig" | grep "Networks are equivalent"
@@ -0,0 +1,133 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+/*!
+  \file npn_canonization.cpp
+  \brief Compares exact NPN canonization algorithms on cut functions
+
+  Enumerates the 6-input cuts of the given AIGs, collects the distinct cut
+  functions (extended to 6 variables), and canonizes them using
+  `kitty::exact_npn_canonization` and `kitty::exact_npn_canonization_pruned`.
+  The functions are written in hexadecimal into the given text file, which
+  can be read by ABC's `testnpn` command.
+
+  \author agent
+*/
+
+#include <chrono>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <unordered_set>
+#include <vector>
+
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/hash.hpp>
+#include <kitty/npn.hpp>
+#include <kitty/operations.hpp>
+#include <kitty/print.hpp>
+#include <lorina/aiger.hpp>
+#include <mockturtle/algorithms/cut_enumeration.hpp>
+#include <mockturtle/io/aiger_reader.hpp>
+#include <mockturtle/networks/aig.hpp>
+
+using namespace mockturtle;
+
+template<typename Fn>
+double measure( std::vector<kitty::dynamic_truth_table> const& functions, std::vector<kitty::dynamic_truth_table>& classes, Fn&& fn )
+{
+  const auto start = std::chrono::steady_clock::now();
+  for ( auto const& tt : functions )
+  {
+    classes.push_back( std::get<0>( fn( tt ) ) );
+  }
+  return std::chrono::duration<double>( std::chrono::steady_clock::now() - start ).count();
+}
+
+int main( int argc, char* argv[] )
+{
+  if ( argc < 3 )
+  {
+    std::cout << "usage: npn_canonization <functions.txt> <file.aig> [<file.aig> ...]\n";
+    return 1;
+  }
+
+  cut_enumeration_params ps;
+  ps.cut_size = 6u;
+  ps.cut_limit = 8u;
+  ps.minimize_truth_table = true;
+
+  std::unordered_set<kitty::dynamic_truth_table, kitty::hash<kitty::dynamic_truth_table>> visited;
+  std::vector<kitty::dynamic_truth_table> functions;
+  for ( auto i = 2; i < argc; ++i )
+  {
+    aig_network aig;
+    if ( lorina::read_aiger( argv[i], aiger_reader( aig ) ) != lorina::return_code::success )
+    {
+      std::cout << "cannot read " << argv[i] << "\n";
+      return 1;
+    }
+
+    const auto cuts = cut_enumeration<aig_network, true>( aig, ps );
+    aig.foreach_node( [&]( auto node ) {
+      for ( auto const& cut : cuts.cuts( aig.node_to_index( node ) ) )
+      {
+        const auto tt = kitty::extend_to( cuts.truth_table( *cut ), 6u );
+        if ( visited.insert( tt ).second )
+        {
+          functions.push_back( tt );
+        }
+      }
+    } );
+  }
+
+  std::ofstream os( argv[1], std::ofstream::out );
+  for ( auto const& tt : functions )
+  {
+    os << kitty::to_hex( tt ) << "\n";
+  }
+
+  std::vector<kitty::dynamic_truth_table> classes_exact, classes_pruned;
+  const auto time_exact = measure( functions, classes_exact, []( auto const& tt ) { return kitty::exact_npn_canonization( tt ); } );
+  const auto time_pruned = measure( functions, classes_pruned, []( auto const& tt ) { return kitty::exact_npn_canonization_pruned( tt ); } );
+
+  auto mismatches = 0u;
+  for ( auto j = 0u; j < functions.size(); ++j )
+  {
+    const auto config = kitty::exact_npn_canonization_pruned( functions[j] );
+    if ( classes_exact[j] != classes_pruned[j] || kitty::create_from_npn_config( config ) != functions[j] )
+    {
+      ++mismatches;
+    }
+  }
+
+  const std::unordered_set<kitty::dynamic_truth_table, kitty::hash<kitty::dynamic_truth_table>> classes( classes_pruned.begin(), classes_pruned.end() );
+  std::cout << "functions = " << functions.size() << "  classes = " << classes.size() << "  mismatches = " << mismatches << "\n";
+  std::cout << "exact  = " << time_exact << " s\n";
+  std::cout << "pruned = " << time_pruned << " s (" << time_exact / time_pruned << "x)\n";
+
+  return mismatches == 0u ? 0 : 1;
+}
@@ -94,7 +94,7 @@ public:
   {
     assert( function.num_vars() <= 4 );
     const auto fe = kitty::extend_to( function, 4 );
-    const auto config = kitty::exact_npn_canonization( fe );
+    const auto config = kitty::exact_npn_canonization_pruned( fe );
 
     const auto it = class2signal.find( static_cast<uint16_t>( std::get<0>( config )._bits[0] ) );
 
@@ -0,0 +1,190 @@
+/* mockturtle: C++ logic network library
+ * Copyright (C) 2018  EPFL
+ *
+ * Permission is hereby granted, free of charge, to any person
+ * obtaining a copy of this software and associated documentation
+ * files (the "Software"), to deal in the Software without
+ * restriction, including without limitation the rights to use,
+ * copy, modify, merge, publish, distribute, sublicense, and/or sell
+ * copies of the Software, and to permit persons to whom the
+ * Software is furnished to do so, subject to the following
+ * conditions:
+ *
+ * The above copyright notice and this permission notice shall be
+ * included in all copies or substantial portions of the Software.
+ *
+ * THE SOFTWARE IS PROVIDED "AS IS", WITHOUT WARRANTY OF ANY KIND,
+ * EXPRESS OR IMPLIED, INCLUDING BUT NOT LIMITED TO THE WARRANTIES
+ * OF MERCHANTABILITY, FITNESS FOR A PARTICULAR PURPOSE AND
+ * NONINFRINGEMENT. IN NO EVENT SHALL THE AUTHORS OR COPYRIGHT
+ * HOLDERS BE LIABLE FOR ANY CLAIM, DAMAGES OR OTHER LIABILITY,
+ * WHETHER IN AN ACTION OF CONTRACT, TORT OR OTHERWISE, ARISING
+ * FROM, OUT OF OR IN CONNECTION WITH THE SOFTWARE OR THE USE OR
+ * OTHER DEALINGS IN THE SOFTWARE.
+ */
+
+
+/*!
+  \file write_mig.hpp
+  \brief Write majority networks to binary MIG format
+
+  \author agent
+*/
+
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <cassert>
+#include <cstdint>
+#include <fstream>
+#include <iostream>
+#include <string>
+#include <vector>
+
+#include <fmt/format.h>
+
+#include "../traits.hpp"
+#include "../views/topo_view.hpp"
+
+namespace mockturtle
+{
+
+namespace detail
+{
+
+inline void write_mig_unsigned( std::ostream& os, uint32_t x )
+{
+  while ( x & ~0x7f )
+  {
+    os.put( static_cast<char>( ( x & 0x7f ) | 0x80 ) );
+    x >>= 7;
+  }
+  os.put( static_cast<char>( x ) );
+}
+
+} /* namespace detail */
+
+/*! \brief Writes majority network in binary MIG format into output stream
+ *
+ * The format is read by ABC's `&if2 <file>` command, which maps the
+ * majority gates into LUTs directly, without decomposing them into AND
+ * gates first.  It is similar to the binary AIGER format.  The header
+ * line `mig M I O N` gives the largest variable index `M = I + N`, the
+ * number of primary inputs `I`, the number of primary outputs `O`, and
+ * the number of gates `N`.  Variable 0 is constant 0, variables 1 to `I`
+ * are the primary inputs, and the gates follow in topological order.  A
+ * literal is twice the variable index plus one if it is complemented.
+ * For each gate, the three fanin literals are sorted in decreasing order
+ * and written as differences: the gate literal minus the first fanin, the
+ * first fanin minus the second, and the second fanin minus the third.  The
+ * output literals follow the gates.  All numbers are written in the 7-bit
+ * variable-length encoding of AIGER.  Only gates reachable from the
+ * outputs are written.
+ *
+ * An overloaded variant exists that writes the network into a file.
+ *
+ * **Required network functions:**
+ * - `get_constant`
+ * - `is_constant`
+ * - `is_pi`
+ * - `is_complemented`
+ * - `get_node`
+ * - `num_pis`
+ * - `num_pos`
+ * - `node_to_index`
+ * - `fanin_size`
+ *
+ * \param ntk Network
+ * \param os Output stream
+ */
+template<class Ntk>
+void write_mig( Ntk const& ntk, std::ostream& os )
+{
+  static_assert( is_network_type_v<Ntk>, "Ntk is not a network type" );
+  static_assert( has_get_constant_v<Ntk>, "Ntk does not implement the get_constant method" );
+  static_assert( has_is_constant_v<Ntk>, "Ntk does not implement the is_constant method" );
+  static_assert( has_is_pi_v<Ntk>, "Ntk does not implement the is_pi method" );
+  static_assert( has_is_complemented_v<Ntk>, "Ntk does not implement the is_complemented method" );
+  static_assert( has_get_node_v<Ntk>, "Ntk does not implement the get_node method" );
+  static_assert( has_num_pis_v<Ntk>, "Ntk does not implement the num_pis method" );
+  static_assert( has_num_pos_v<Ntk>, "Ntk does not implement the num_pos method" );
+  static_assert( has_node_to_index_v<Ntk>, "Ntk does not implement the node_to_index method" );
+  static_assert( has_fanin_size_v<Ntk>, "Ntk does not implement the fanin_size method" );
+
+  topo_view topo{ntk};
+
+  /* assign variables to constants, inputs, and gates in topological order */
+  std::vector<uint32_t> lits( ntk.size(), 0u );
+  std::vector<typename Ntk::node> gates;
+  lits[ntk.node_to_index( ntk.get_node( ntk.get_constant( true ) ) )] = ntk.is_complemented( ntk.get_constant( true ) ) ? 0u : 1u;
+  lits[ntk.node_to_index( ntk.get_node( ntk.get_constant( false ) ) )] = 0u;
+
+  uint32_t var = 0u;
+  topo.foreach_node( [&]( auto const& n ) {
+    if ( ntk.is_constant( n ) )
+      return; /* continue */
+
+    lits[ntk.node_to_index( n )] = 2 * ++var;
+    if ( !ntk.is_pi( n ) )
+    {
+      gates.push_back( n );
+    }
+  } );
+  assert( var == ntk.num_pis() + gates.size() );
+
+  const auto lit = [&]( auto const& f ) {
+    return lits[ntk.node_to_index( ntk.get_node( f ) )] ^ ( ntk.is_complemented( f ) ? 1u : 0u );
+  };
+
+  os << fmt::format( "mig {} {} {} {}\n", var, ntk.num_pis(), ntk.num_pos(), gates.size() );
+
+  for ( auto const& n : gates )
+  {
+    assert( ntk.fanin_size( n ) == 3u );
+
+    std::array<uint32_t, 3> fanins;
+    ntk.foreach_fanin( n, [&]( auto const& f, auto i ) {
+      fanins[i] = lit( f );
+    } );
+    std::sort( fanins.begin(), fanins.end(), std::greater<uint32_t>() );
+
+    const auto l = lits[ntk.node_to_index( n )];
+    assert( l > fanins[0] );
+    detail::write_mig_unsigned( os, l - fanins[0] );
+    detail::write_mig_unsigned( os, fanins[0] - fanins[1] );
+    detail::write_mig_unsigned( os, fanins[1] - fanins[2] );
+  }
+
+  ntk.foreach_po( [&]( auto const& f ) {
+    detail::write_mig_unsigned( os, lit( f ) );
+  } );
+
+  os << std::flush;
+}
+
+/*! \brief Writes majority network in binary MIG format into a file
+ *
+ * **Required network functions:**
+ * - `get_constant`
+ * - `is_constant`
+ * - `is_pi`
+ * - `is_complemented`
+ * - `get_node`
+ * - `num_pis`
+ * - `num_pos`
+ * - `node_to_index`
+ * - `fanin_size`
+ *
+ * \param ntk Network
+ * \param filename Filename
+ */
+template<class Ntk>
+void write_mig( Ntk const& ntk, std::string const& filename )
+{
+  std::ofstream os( filename.c_str(), std::ofstream::out | std::ofstream::binary );
+  write_mig( ntk, os );
+  os.close();
+}
+
+} /* namespace mockturtle */
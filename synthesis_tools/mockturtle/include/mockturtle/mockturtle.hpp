@@ -54,6 +54,7 @@
 #include "io/bench_reader.hpp"
 #include "io/verilog_reader.hpp"
 #include "io/write_bench.hpp"
+#include "io/write_mig.hpp"
 #include "networks/aig.hpp"
 #include "networks/klut.hpp"
 #include "networks/mig.hpp"
@@ -32,7 +32,9 @@
 
 #pragma once
 
+#include <algorithm>
 #include <numeric>
+#include <unordered_set>
 
 #include "detail/constants.hpp"
 #include "operators.hpp"
@@ -182,6 +184,267 @@ std::tuple<TT, uint32_t, std::vector<uint8_t>> exact_npn_canonization( const TT&
   return std::make_tuple( tmin, phase, perm );
 }
 
+/*! \cond PRIVATE */
+namespace detail
+{
+
+/* candidates of the pruned exact NPN canonization are partially transformed
+   truth tables (stretched to 6 variables) together with their configuration:
+   the variable in position i is stored in bits [4i, 4i+3], the phase of
+   position i in bit 32+4i, and the output phase in bit 60 */
+inline uint64_t npn_pruned_swap_config( uint64_t config, uint8_t k, uint8_t q )
+{
+  const auto shift = 4 * ( q - k );
+  const auto mask = ( UINT64_C( 0xf ) << ( 4 * k ) ) | ( UINT64_C( 1 ) << ( 32 + 4 * k ) );
+  const auto x = ( ( config >> shift ) ^ config ) & mask;
+  return config ^ x ^ ( x << shift );
+}
+
+inline uint64_t npn_pruned_swap( uint64_t word, uint8_t k, uint8_t q )
+{
+  const auto& pmask = ppermutation_masks[k][q];
+  const auto shift = ( 1 << q ) - ( 1 << k );
+  return ( word & pmask[0] ) | ( ( word & pmask[1] ) << shift ) | ( ( word & pmask[2] ) >> shift );
+}
+
+inline int npn_pruned_last_bit( uint64_t word )
+{
+  auto index = -1;
+  for ( ; word; word >>= 1 )
+  {
+    ++index;
+  }
+  return index;
+}
+
+/* minterms in which w variables in positions k and above are 1 (indexed by k and w) */
+static constexpr uint64_t npn_pruned_weight_masks[][7] = {
+    {UINT64_C( 0x0000000000000001 ), UINT64_C( 0x0000000100010116 ), UINT64_C( 0x0001011601161668 ), UINT64_C( 0x0116166816686880 ), UINT64_C( 0x1668688068808000 ), UINT64_C( 0x6880800080000000 ), UINT64_C( 0x8000000000000000 )},
+    {UINT64_C( 0x0000000000000003 ), UINT64_C( 0x000000030003033c ), UINT64_C( 0x0003033c033c3cc0 ), UINT64_C( 0x033c3cc03cc0c000 ), UINT64_C( 0x3cc0c000c0000000 ), UINT64_C( 0xc000000000000000 ), UINT64_C( 0x0000000000000000 )},
+    {UINT64_C( 0x000000000000000f ), UINT64_C( 0x0000000f000f0ff0 ), UINT64_C( 0x000f0ff00ff0f000 ), UINT64_C( 0x0ff0f000f0000000 ), UINT64_C( 0xf000000000000000 ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 )},
+    {UINT64_C( 0x00000000000000ff ), UINT64_C( 0x000000ff00ffff00 ), UINT64_C( 0x00ffff00ff000000 ), UINT64_C( 0xff00000000000000 ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 )},
+    {UINT64_C( 0x000000000000ffff ), UINT64_C( 0x0000ffffffff0000 ), UINT64_C( 0xffff000000000000 ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 )},
+    {UINT64_C( 0x00000000ffffffff ), UINT64_C( 0xffffffff00000000 ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 )},
+    {UINT64_C( 0xffffffffffffffff ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 ), UINT64_C( 0x0000000000000000 )}};
+
+/* keeps the first candidate for each truth table */
+inline void npn_pruned_dedup( std::vector<uint64_t>& words, std::vector<uint64_t>& configs, std::unordered_set<uint64_t>& visited )
+{
+  const auto use_hash = words.size() > 16u;
+  if ( use_hash )
+  {
+    visited.clear();
+  }
+
+  std::size_t size = 0u;
+  for ( std::size_t i = 0u; i < words.size(); ++i )
+  {
+    const auto duplicate = use_hash ? !visited.insert( words[i] ).second
+                                    : std::find( words.begin(), words.begin() + size, words[i] ) != words.begin() + size;
+    if ( duplicate )
+    {
+      continue;
+    }
+    words[size] = words[i];
+    configs[size++] = configs[i];
+  }
+  words.resize( size );
+  configs.resize( size );
+}
+
+/* finds a small truth table in the NPN class using flips and adjacent swaps */
+inline uint64_t npn_pruned_upper_bound( uint64_t word, uint8_t num_vars )
+{
+  word = std::min( word, ~word );
+  auto improvement = true;
+  while ( improvement )
+  {
+    improvement = false;
+    for ( uint8_t i = 0; i < num_vars; ++i )
+    {
+      auto next = ( ( word << ( 1 << i ) ) & projections[i] ) | ( ( word & projections[i] ) >> ( 1 << i ) );
+      next = std::min( next, ~next );
+      if ( next < word )
+      {
+        word = next;
+        improvement = true;
+      }
+    }
+    for ( uint8_t i = 0; i + 1 < num_vars; ++i )
+    {
+      const auto next = npn_pruned_swap( word, i, i + 1 );
+      if ( next < word )
+      {
+        word = next;
+        improvement = true;
+      }
+    }
+  }
+  return word & masks[num_vars];
+}
+
+/* removes the candidates whose most significant 1 cannot be placed below the
+   one of the best truth table found so far */
+inline void npn_pruned_prune( std::vector<uint64_t>& words, std::vector<uint64_t>& configs, uint8_t num_fixed, uint8_t num_vars, uint64_t& best )
+{
+  for ( auto w : words )
+  {
+    best = std::min( best, w & masks[num_vars] );
+  }
+  const auto bound = npn_pruned_last_bit( best );
+
+  std::size_t size = 0u;
+  for ( std::size_t i = 0u; i < words.size(); ++i )
+  {
+    const auto x = words[i] & masks[num_vars];
+    if ( x )
+    {
+      auto weight = num_vars - num_fixed;
+      while ( ( x & npn_pruned_weight_masks[num_fixed][weight] ) == 0u )
+      {
+        --weight;
+      }
+      auto y = x & npn_pruned_weight_masks[num_fixed][weight];
+      for ( auto j = num_fixed; j < num_vars; ++j )
+      {
+        y |= y >> ( 1 << j );
+      }
+      if ( ( ( ( 1 << weight ) - 1 ) << num_fixed ) + npn_pruned_last_bit( y & masks[num_fixed] ) > bound )
+      {
+        continue;
+      }
+    }
+    words[size] = words[i];
+    configs[size++] = configs[i];
+  }
+  words.resize( size );
+  configs.resize( size );
+}
+
+} /* namespace detail */
+/*! \endcond */
+
+/*! \brief Exact NPN canonization with pruning
+
+  Computes the same NPN representative as `exact_npn_canonization`, i.e.,
+  the lexicographically smallest truth table in the NPN class, for
+  functions with up to 6 variables.  Instead of enumerating all
+  \f$2^{n+1} n!\f$ transformations, it first applies all input negations
+  (the output negation is chosen to make the most significant bit 0) and
+  then fixes the variables in positions 0, 1, ..., *n*-1.  Fixing position
+  *k* determines the \f$2^{k+1}\f$ most significant bits, since they
+  correspond to the minterms in which all variables in positions above *k*
+  are 1.  Only the candidates with the smallest such bits are kept, and
+  candidates with equal truth tables are merged.  Candidates whose most
+  significant 1 cannot be moved below the one of a truth table found by
+  local search are removed, which helps for functions with few minterms.
+
+  The same algorithm is implemented in ABC as `Abc_TtCanonicizeExact`
+  (`testnpn -A 9`).
+
+  The function returns a NPN configuration which contains the necessary
+  transformations to obtain the representative.  It is a tuple of
+
+  - the NPN representative
+  - input negations and output negation, output negation is stored as bit *n*,
+    where *n* is the number of variables in `tt`
+  - input permutation to apply
+
+  \param tt The truth table (with at most 6 variables)
+  \return NPN configuration
+*/
+template<typename TT>
+std::tuple<TT, uint32_t, std::vector<uint8_t>> exact_npn_canonization_pruned( const TT& tt )
+{
+  const auto num_vars = tt.num_vars();
+  assert( num_vars <= 6 );
+
+  /* stretch the truth table to 6 variables */
+  auto word = *tt.cbegin() & detail::masks[num_vars];
+  for ( auto i = num_vars; i < 6; ++i )
+  {
+    word |= word << ( 1 << i );
+  }
+
+  uint64_t config{0u};
+  for ( auto i = 0; i < num_vars; ++i )
+  {
+    config |= uint64_t( i ) << ( 4 * i );
+  }
+
+  /* input negations in Gray code order */
+  auto best = detail::npn_pruned_upper_bound( word, num_vars );
+
+  std::vector<uint64_t> words, configs, next_words, next_configs;
+  std::unordered_set<uint64_t> visited;
+  for ( auto m = 0u; m < ( 1u << num_vars ); ++m )
+  {
+    if ( m > 0u )
+    {
+      auto var_index = 0;
+      while ( ( ( m >> var_index ) & 1u ) == 0u )
+      {
+        ++var_index;
+      }
+      word = ( ( word << ( 1 << var_index ) ) & detail::projections[var_index] ) | ( ( word & detail::projections[var_index] ) >> ( 1 << var_index ) );
+      config ^= UINT64_C( 1 ) << ( 32 + 4 * var_index );
+    }
+    const auto invo = word >> 63;
+    words.push_back( invo ? ~word : word );
+    configs.push_back( config | ( invo << 60 ) );
+  }
+  detail::npn_pruned_prune( words, configs, 0, num_vars, best );
+  detail::npn_pruned_dedup( words, configs, visited );
+
+  /* fix the positions */
+  for ( uint8_t k = 0; k + 1 < num_vars; ++k )
+  {
+    const auto shift = 64 - ( 2 << k );
+    auto key_min = ~UINT64_C( 0 );
+    for ( uint8_t q = k; q < num_vars; ++q )
+    {
+      for ( auto w : words )
+      {
+        key_min = std::min( key_min, ( q == k ? w : detail::npn_pruned_swap( w, k, q ) ) >> shift );
+      }
+    }
+
+    next_words.clear();
+    next_configs.clear();
+    for ( uint8_t q = k; q < num_vars; ++q )
+    {
+      for ( std::size_t i = 0u; i < words.size(); ++i )
+      {
+        const auto w = q == k ? words[i] : detail::npn_pruned_swap( words[i], k, q );
+        if ( ( w >> shift ) == key_min )
+        {
+          next_words.push_back( w );
+          next_configs.push_back( q == k ? configs[i] : detail::npn_pruned_swap_config( configs[i], k, q ) );
+        }
+      }
+    }
+    detail::npn_pruned_prune( next_words, next_configs, k + 1, num_vars, best );
+    detail::npn_pruned_dedup( next_words, next_configs, visited );
+    std::swap( words, next_words );
+    std::swap( configs, next_configs );
+  }
+
+  const auto index = std::distance( words.begin(), std::min_element( words.begin(), words.end() ) );
+
+  auto tmin = tt;
+  *tmin.begin() = words[index] & detail::masks[num_vars];
+
+  std::vector<uint8_t> perm( num_vars );
+  uint32_t phase = uint32_t( ( configs[index] >> 60 ) & 1 ) << num_vars;
+  for ( auto i = 0; i < num_vars; ++i )
+  {
+    perm[i] = ( configs[index] >> ( 4 * i ) ) & 0xf;
+    phase |= uint32_t( ( configs[index] >> ( 32 + 4 * i ) ) & 1 ) << perm[i];
+  }
+
+  return std::make_tuple( tmin, phase, perm );
+}
+
 /*! \brief Flip-swap NPN heuristic
 
   This algorithm will iteratively try to reduce the numeric value of the truth
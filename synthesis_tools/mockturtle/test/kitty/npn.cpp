@@ -0,0 +1,87 @@
+#include <catch.hpp>
+
+#include <cstdint>
+
+#include <kitty/bit_operations.hpp>
+#include <kitty/constructors.hpp>
+#include <kitty/dynamic_truth_table.hpp>
+#include <kitty/npn.hpp>
+#include <kitty/operations.hpp>
+#include <kitty/operators.hpp>
+#include <kitty/static_truth_table.hpp>
+
+using namespace kitty;
+
+namespace
+{
+
+template<typename TT>
+void check_pruned_npn( TT const& tt )
+{
+  const auto exact = exact_npn_canonization( tt );
+  const auto pruned = exact_npn_canonization_pruned( tt );
+
+  CHECK( std::get<0>( pruned ) == std::get<0>( exact ) );
+  CHECK( create_from_npn_config( pruned ) == tt );
+}
+
+template<int NumVars>
+void check_pruned_npn_exhaustive()
+{
+  static_truth_table<NumVars> tt;
+  do
+  {
+    check_pruned_npn( tt );
+    next_inplace( tt );
+  } while ( !is_const0( tt ) );
+}
+
+template<int NumVars>
+void check_pruned_npn_random( uint32_t num_functions )
+{
+  static_truth_table<NumVars> tt;
+  for ( auto i = 0u; i < num_functions; ++i )
+  {
+    create_random( tt, i );
+    check_pruned_npn( tt );
+  }
+}
+
+} // namespace
+
+TEST_CASE( "pruned exact NPN canonization matches exhaustive canonization for small functions", "[npn]" )
+{
+  check_pruned_npn_exhaustive<0>();
+  check_pruned_npn_exhaustive<1>();
+  check_pruned_npn_exhaustive<2>();
+  check_pruned_npn_exhaustive<3>();
+  check_pruned_npn_exhaustive<4>();
+}
+
+TEST_CASE( "pruned exact NPN canonization matches exhaustive canonization for random functions", "[npn]" )
+{
+  check_pruned_npn_random<5>( 500u );
+  check_pruned_npn_random<6>( 200u );
+}
+
+TEST_CASE( "pruned exact NPN canonization of sparse and symmetric 6-input functions", "[npn]" )
+{
+  dynamic_truth_table tt( 6 );
+
+  /* single minterms and their complements */
+  for ( auto m = 0u; m < 64u; m += 7u )
+  {
+    clear( tt );
+    set_bit( tt, m );
+    check_pruned_npn( tt );
+    check_pruned_npn( ~tt );
+  }
+
+  /* majority, parity, and threshold functions */
+  create_majority( tt );
+  check_pruned_npn( tt );
+  create_parity( tt );
+  check_pruned_npn( tt );
+  create_threshold( tt, 2 );
+  check_pruned_npn( tt );
+}